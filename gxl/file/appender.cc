@@ -0,0 +1,254 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gxl/file/appender.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif  // _WIN32
+
+#include <cerrno>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>  // NOLINT
+#include <utility>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/time.h"
+
+namespace gxl {
+namespace {
+
+#ifndef _WIN32
+
+absl::StatusOr<int> OpenForAppend(absl::string_view filename) {
+  const std::string null_terminated_name(filename);
+  const int fd = open(null_terminated_name.c_str(),
+                      O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC, 0666);
+  if (fd < 0) {
+    return absl::ErrnoToStatus(errno,
+                               absl::StrCat("Could not open '", filename, "'"));
+  }
+  return fd;
+}
+
+absl::Status WriteFully(int fd, absl::string_view data,
+                        absl::string_view filename) {
+  while (!data.empty()) {
+    const ssize_t n = write(fd, data.data(), data.size());
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return absl::ErrnoToStatus(
+          errno, absl::StrCat("Could not write to '", filename, "'"));
+    }
+    data.remove_prefix(n);
+  }
+  return absl::OkStatus();
+}
+
+absl::Status DataSync(int fd, absl::string_view filename) {
+#ifdef __APPLE__
+  const int ret = fsync(fd);
+#else
+  const int ret = fdatasync(fd);
+#endif  // __APPLE__
+  if (ret != 0) {
+    return absl::ErrnoToStatus(errno,
+                               absl::StrCat("Could not sync '", filename, "'"));
+  }
+  return absl::OkStatus();
+}
+
+absl::Status CloseFd(int fd, absl::string_view filename) {
+  if (close(fd) != 0) {
+    return absl::ErrnoToStatus(
+        errno, absl::StrCat("Could not close '", filename, "'"));
+  }
+  return absl::OkStatus();
+}
+
+#else  // _WIN32
+
+absl::Status Unsupported(absl::string_view filename) {
+  return absl::Status(
+      absl::StatusCode::kUnimplemented,
+      absl::StrCat("Cannot append to '", filename,
+                   "': FileAppender is not supported on this platform"));
+}
+
+absl::StatusOr<int> OpenForAppend(absl::string_view filename) {
+  return Unsupported(filename);
+}
+
+absl::Status WriteFully(int, absl::string_view, absl::string_view filename) {
+  return Unsupported(filename);
+}
+
+absl::Status DataSync(int, absl::string_view filename) {
+  return Unsupported(filename);
+}
+
+absl::Status CloseFd(int, absl::string_view filename) {
+  return Unsupported(filename);
+}
+
+#endif  // _WIN32
+
+}  // namespace
+
+absl::StatusOr<std::unique_ptr<FileAppender>> FileAppender::Open(
+    absl::string_view filename, const Options& options) {
+  absl::StatusOr<int> fd = OpenForAppend(filename);
+  if (!fd.ok()) {
+    return fd.status();
+  }
+  return std::unique_ptr<FileAppender>(
+      new FileAppender(*fd, std::string(filename), options));
+}
+
+FileAppender::FileAppender(int fd, std::string filename,
+                           const Options& options)
+    : filename_(std::move(filename)), options_(options), fd_(fd) {
+  buffer_.reserve(options_.buffer_size);
+  if (options_.flush_interval > absl::ZeroDuration()) {
+    flush_thread_ = std::thread([this] { FlushLoop(); });
+  }
+}
+
+FileAppender::~FileAppender() { Close().IgnoreError(); }
+
+absl::Status FileAppender::Append(absl::string_view data) {
+  absl::MutexLock lock(&mu_);
+  if (closing_) {
+    return absl::Status(absl::StatusCode::kFailedPrecondition,
+                        absl::StrCat("'", filename_, "' is closed"));
+  }
+  if (!error_.ok()) {
+    return error_;
+  }
+  buffer_.append(data.data(), data.size());
+  appended_ += data.size();
+  if (buffer_.size() < options_.buffer_size) {
+    return absl::OkStatus();
+  }
+  return WriteUpTo(appended_, options_.sync_on_flush);
+}
+
+absl::Status FileAppender::Flush() {
+  absl::MutexLock lock(&mu_);
+  if (closing_) {
+    return absl::Status(absl::StatusCode::kFailedPrecondition,
+                        absl::StrCat("'", filename_, "' is closed"));
+  }
+  return WriteUpTo(appended_, /*sync=*/false);
+}
+
+absl::Status FileAppender::Sync() {
+  absl::MutexLock lock(&mu_);
+  if (closing_) {
+    return absl::Status(absl::StatusCode::kFailedPrecondition,
+                        absl::StrCat("'", filename_, "' is closed"));
+  }
+  return WriteUpTo(appended_, /*sync=*/true);
+}
+
+absl::Status FileAppender::Close() {
+  {
+    absl::MutexLock lock(&mu_);
+    if (closing_) {
+      return absl::Status(absl::StatusCode::kFailedPrecondition,
+                          absl::StrCat("'", filename_, "' is closed"));
+    }
+    closing_ = true;
+  }
+  if (flush_thread_.joinable()) {
+    flush_thread_.join();
+  }
+  absl::MutexLock lock(&mu_);
+  absl::Status status = WriteUpTo(appended_, /*sync=*/true);
+  absl::Status close_status = CloseFd(fd_, filename_);
+  fd_ = -1;
+  if (status.ok()) {
+    status = std::move(close_status);
+  }
+  return status;
+}
+
+absl::Status FileAppender::WriteUpTo(uint64_t target, bool sync) {
+  // Only one thread does I/O at a time. Everything buffered when it starts is
+  // written in one go, so callers that queue up behind it share the next
+  // write and fdatasync() instead of issuing one each.
+  while (true) {
+    if (!error_.ok()) {
+      return error_;
+    }
+    if ((sync ? synced_ : written_) >= target) {
+      return absl::OkStatus();
+    }
+    if (!io_in_progress_) {
+      break;
+    }
+    mu_.Await(absl::Condition(this, &FileAppender::IoIdle));
+  }
+  if (fd_ < 0) {
+    return absl::Status(absl::StatusCode::kFailedPrecondition,
+                        absl::StrCat("'", filename_, "' is closed"));
+  }
+
+  io_in_progress_ = true;
+  std::string data;
+  data.swap(buffer_);
+  buffer_.swap(spare_);
+  const uint64_t end = appended_;
+  const int fd = fd_;
+  mu_.Unlock();
+  absl::Status status = WriteFully(fd, data, filename_);
+  if (status.ok() && sync) {
+    status = DataSync(fd, filename_);
+  }
+  mu_.Lock();
+
+  data.clear();
+  spare_ = std::move(data);
+  io_in_progress_ = false;
+  if (!status.ok()) {
+    error_ = status;
+    return status;
+  }
+  written_ = end;
+  if (sync) {
+    synced_ = end;
+  }
+  return absl::OkStatus();
+}
+
+void FileAppender::FlushLoop() {
+  absl::MutexLock lock(&mu_);
+  while (!mu_.AwaitWithTimeout(absl::Condition(&closing_),
+                               options_.flush_interval)) {
+    if (appended_ > written_ && error_.ok()) {
+      // A failure is sticky and reported by the next caller.
+      WriteUpTo(appended_, options_.sync_on_flush).IgnoreError();
+    }
+  }
+}
+
+}  // namespace gxl
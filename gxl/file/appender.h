@@ -0,0 +1,121 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GXL_FILE_APPENDER_H_
+#define GXL_FILE_APPENDER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>  // NOLINT
+
+#include "absl/base/thread_annotations.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/time.h"
+
+namespace gxl {
+
+// A long-lived, thread-safe appender for logs that receive many small
+// records. Unlike AppendStringToFile(), which opens and closes the file on
+// every call, it keeps the file open and batches records in memory.
+//
+// Append() only copies the record into the buffer. Buffered records go to
+// the kernel when the buffer fills, every flush_interval, and on Flush(),
+// Sync() or Close(). Sync() also waits until the data is on stable storage.
+// Concurrent Sync() calls are group-committed: records appended while one
+// fdatasync() is running are covered together by the next one.
+//
+// Usage:
+//
+//   ASSIGN_OR_RETURN(std::unique_ptr<FileAppender> log,
+//                    FileAppender::Open("/var/log/audit", {}));
+//   RETURN_IF_ERROR(log->Append(record));
+//   RETURN_IF_ERROR(log->Sync());  // Durable from here on.
+//
+// Write errors are sticky: once a write fails, every later call returns the
+// same error.
+class FileAppender {
+ public:
+  struct Options {
+    // Buffered bytes that trigger a write from the appending thread.
+    size_t buffer_size = 256 << 10;
+
+    // Maximum time a record stays in memory before a background flush.
+    // absl::ZeroDuration() disables the background thread.
+    absl::Duration flush_interval = absl::Milliseconds(100);
+
+    // Also fdatasync() on size- and interval-triggered flushes, not only in
+    // Sync() and Close().
+    bool sync_on_flush = false;
+  };
+
+  // Opens "filename" for appending, creating it if needed.
+  static absl::StatusOr<std::unique_ptr<FileAppender>> Open(
+      absl::string_view filename, const Options& options);
+
+  FileAppender(const FileAppender&) = delete;
+  FileAppender& operator=(const FileAppender&) = delete;
+
+  // Closes the file if Close() was not called, ignoring errors.
+  ~FileAppender();
+
+  // Buffers "data" for writing.
+  absl::Status Append(absl::string_view data);
+
+  // Hands everything appended so far to the kernel.
+  absl::Status Flush();
+
+  // Makes everything appended so far durable.
+  absl::Status Sync();
+
+  // Syncs and closes the file. Later calls fail.
+  absl::Status Close();
+
+ private:
+  FileAppender(int fd, std::string filename, const Options& options);
+
+  // Writes out buffered data until everything before logical offset
+  // "target" is written, and synced if "sync" is true.
+  absl::Status WriteUpTo(uint64_t target, bool sync)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  bool IoIdle() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    return !io_in_progress_;
+  }
+
+  void FlushLoop();
+
+  const std::string filename_;
+  const Options options_;
+
+  absl::Mutex mu_;
+  int fd_ ABSL_GUARDED_BY(mu_);
+  std::string buffer_ ABSL_GUARDED_BY(mu_);
+  std::string spare_ ABSL_GUARDED_BY(mu_);  // Reused for the next buffer.
+  uint64_t appended_ ABSL_GUARDED_BY(mu_) = 0;  // Logical end of buffer_.
+  uint64_t written_ ABSL_GUARDED_BY(mu_) = 0;
+  uint64_t synced_ ABSL_GUARDED_BY(mu_) = 0;
+  bool io_in_progress_ ABSL_GUARDED_BY(mu_) = false;
+  bool closing_ ABSL_GUARDED_BY(mu_) = false;
+  absl::Status error_ ABSL_GUARDED_BY(mu_);
+
+  std::thread flush_thread_;
+};
+
+}  // namespace gxl
+
+#endif  // GXL_FILE_APPENDER_H_
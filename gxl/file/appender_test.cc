@@ -0,0 +1,159 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gxl/file/appender.h"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <thread>  // NOLINT
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/string_view.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "gtest/gtest.h"
+#include "gxl/file/file.h"
+
+namespace gxl {
+namespace {
+
+std::string TestFile(absl::string_view name) {
+  const std::string filename = absl::StrCat(testing::TempDir(), "/", name);
+  unlink(filename.c_str());
+  return filename;
+}
+
+std::string ReadFile(absl::string_view filename) {
+  std::string contents;
+  EXPECT_TRUE(GetContents(filename, &contents, file::Defaults()).ok());
+  return contents;
+}
+
+TEST(FileAppenderTest, AppendsAcrossReopens) {
+  const std::string filename = TestFile("appender");
+  for (absl::string_view record : {"a\n", "bc\n"}) {
+    absl::StatusOr<std::unique_ptr<FileAppender>> appender =
+        FileAppender::Open(filename, {});
+    ASSERT_TRUE(appender.ok()) << appender.status();
+    EXPECT_TRUE((*appender)->Append(record).ok());
+    EXPECT_TRUE((*appender)->Close().ok());
+  }
+  EXPECT_EQ(ReadFile(filename), "a\nbc\n");
+}
+
+TEST(FileAppenderTest, ConcurrentAppendAndSync) {
+  const std::string filename = TestFile("appender_concurrent");
+  // A small buffer makes the appending threads write as well, while other
+  // threads are in Sync() or Flush().
+  absl::StatusOr<std::unique_ptr<FileAppender>> appender =
+      FileAppender::Open(filename, {.buffer_size = 64,
+                                    .flush_interval = absl::Milliseconds(1)});
+  ASSERT_TRUE(appender.ok()) << appender.status();
+  constexpr int kNumThreads = 8;
+  constexpr int kNumRecords = 500;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kNumThreads; ++t) {
+    threads.emplace_back([&appender, t] {
+      for (int i = 0; i < kNumRecords; ++i) {
+        EXPECT_TRUE((*appender)->Append(absl::StrCat(t, ":", i, "\n")).ok());
+        if (i % 50 == 0) {
+          EXPECT_TRUE(
+              (t % 2 == 0 ? (*appender)->Sync() : (*appender)->Flush()).ok());
+        }
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  ASSERT_TRUE((*appender)->Close().ok());
+
+  // Every record is there once and in one piece, and the records of each
+  // thread are in order.
+  std::vector<int> next(kNumThreads, 0);
+  const std::string contents = ReadFile(filename);
+  for (absl::string_view line :
+       absl::StrSplit(contents, '\n', absl::SkipEmpty())) {
+    const std::vector<std::string> parts = absl::StrSplit(line, ':');
+    ASSERT_EQ(parts.size(), 2) << line;
+    const int t = std::stoi(parts[0]);
+    ASSERT_GE(t, 0);
+    ASSERT_LT(t, kNumThreads);
+    EXPECT_EQ(parts[1], absl::StrCat(next[t]++));
+  }
+  EXPECT_EQ(next, std::vector<int>(kNumThreads, kNumRecords));
+}
+
+TEST(FileAppenderTest, ErrorsAreSticky) {
+  // Writes to /dev/full fail with ENOSPC.
+  absl::StatusOr<std::unique_ptr<FileAppender>> appender =
+      FileAppender::Open("/dev/full", {.flush_interval = absl::ZeroDuration()});
+  ASSERT_TRUE(appender.ok()) << appender.status();
+  EXPECT_TRUE((*appender)->Append("data").ok());  // Only buffered.
+  const absl::Status error = (*appender)->Flush();
+  EXPECT_EQ(error.code(), absl::StatusCode::kResourceExhausted) << error;
+  EXPECT_EQ((*appender)->Append("more"), error);
+  EXPECT_EQ((*appender)->Flush(), error);
+  EXPECT_EQ((*appender)->Sync(), error);
+  EXPECT_EQ((*appender)->Close(), error);
+}
+
+TEST(FileAppenderTest, FlushesInTheBackground) {
+  const std::string filename = TestFile("appender_timed");
+  absl::StatusOr<std::unique_ptr<FileAppender>> appender =
+      FileAppender::Open(filename,
+                         {.flush_interval = absl::Milliseconds(10)});
+  ASSERT_TRUE(appender.ok()) << appender.status();
+  ASSERT_TRUE((*appender)->Append("record\n").ok());
+  const absl::Time deadline = absl::Now() + absl::Seconds(10);
+  while (ReadFile(filename).empty() && absl::Now() < deadline) {
+    absl::SleepFor(absl::Milliseconds(5));
+  }
+  EXPECT_EQ(ReadFile(filename), "record\n");
+  EXPECT_TRUE((*appender)->Close().ok());
+}
+
+TEST(FileAppenderTest, NoBackgroundFlushWithZeroInterval) {
+  const std::string filename = TestFile("appender_untimed");
+  absl::StatusOr<std::unique_ptr<FileAppender>> appender =
+      FileAppender::Open(filename, {.flush_interval = absl::ZeroDuration()});
+  ASSERT_TRUE(appender.ok()) << appender.status();
+  ASSERT_TRUE((*appender)->Append("record\n").ok());
+  absl::SleepFor(absl::Milliseconds(50));
+  EXPECT_EQ(ReadFile(filename), "");
+  ASSERT_TRUE((*appender)->Flush().ok());
+  EXPECT_EQ(ReadFile(filename), "record\n");
+  EXPECT_TRUE((*appender)->Close().ok());
+}
+
+TEST(FileAppenderTest, FailsAfterClose) {
+  absl::StatusOr<std::unique_ptr<FileAppender>> appender =
+      FileAppender::Open(TestFile("appender_closed"), {});
+  ASSERT_TRUE(appender.ok()) << appender.status();
+  ASSERT_TRUE((*appender)->Close().ok());
+  EXPECT_EQ((*appender)->Append("x").code(),
+            absl::StatusCode::kFailedPrecondition);
+  EXPECT_EQ((*appender)->Sync().code(), absl::StatusCode::kFailedPrecondition);
+  EXPECT_EQ((*appender)->Close().code(),
+            absl::StatusCode::kFailedPrecondition);
+}
+
+}  // namespace
+}  // namespace gxl
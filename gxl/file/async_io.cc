@@ -0,0 +1,683 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gxl/file/async_io.h"
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+// IORING_FEAT_RW_CUR_POS arrived with the opcodes used below (Linux 5.6).
+#if defined(__NR_io_uring_setup) && defined(IORING_FEAT_RW_CUR_POS)
+#define GXL_FILE_HAVE_IO_URING 1
+#endif
+#endif  // __has_include(<linux/io_uring.h>)
+#endif  // __linux__
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <future>  // NOLINT
+#include <memory>
+#include <string>
+#include <thread>  // NOLINT
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/log/check.h"
+#include "absl/log/log.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/synchronization/mutex.h"
+#include "gxl/file/file.h"
+#include "gxl/file/internal/thread_pool.h"
+#include "gxl/status/status_macros.h"
+
+namespace gxl {
+
+// Common bookkeeping for the backends: counts outstanding requests so that
+// Wait() and the destructor can drain them.
+class AsyncIO::Engine {
+ public:
+  enum class Kind { kGetContents, kReadRange, kSetContents };
+
+  struct Request {
+    Kind kind;
+    std::string filename;
+    uint64_t offset = 0;
+    size_t size = 0;
+    std::string contents;  // Data to write for kSetContents.
+    ReadCallback read_done;
+    WriteCallback write_done;
+  };
+
+  virtual ~Engine() = default;
+
+  virtual Backend backend() const = 0;
+
+  void Submit(std::unique_ptr<Request> request) {
+    {
+      absl::MutexLock lock(&mu_);
+      ++outstanding_;
+    }
+    Start(std::move(request));
+  }
+
+  void Wait() {
+    absl::MutexLock lock(&mu_);
+    mu_.Await(absl::Condition(this, &Engine::Idle));
+  }
+
+ protected:
+  virtual void Start(std::unique_ptr<Request> request) = 0;
+
+  // Delivers the result of "request" to its callback and retires it.
+  void Complete(Request& request, absl::Status status, std::string data) {
+    if (request.read_done) {
+      if (status.ok()) {
+        std::move(request.read_done)(std::move(data));
+      } else {
+        std::move(request.read_done)(std::move(status));
+      }
+    } else {
+      std::move(request.write_done)(std::move(status));
+    }
+    absl::MutexLock lock(&mu_);
+    --outstanding_;
+  }
+
+ private:
+  bool Idle() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    return outstanding_ == 0;
+  }
+
+  absl::Mutex mu_;
+  int64_t outstanding_ ABSL_GUARDED_BY(mu_) = 0;
+};
+
+namespace {
+
+using Engine = AsyncIO::Engine;
+
+// Runs every request as blocking calls on a thread pool. Each thread runs one
+// request at a time, so the pool is capped at queue_depth threads; further
+// requests wait in the pool's queue.
+class ThreadPoolEngine : public Engine {
+ public:
+  ThreadPoolEngine(int num_threads, int queue_depth)
+      : pool_(std::min(num_threads > 0
+                           ? num_threads
+                           : internal::ThreadPool::DefaultNumThreads(),
+                       queue_depth)) {}
+
+  AsyncIO::Backend backend() const override {
+    return AsyncIO::Backend::kThreadPool;
+  }
+
+ protected:
+  void Start(std::unique_ptr<Request> request) override {
+    pool_.Schedule([this, request = std::move(request)]() mutable {
+      Run(*request);
+    });
+  }
+
+ private:
+  void Run(Request& request) {
+    std::string data;
+    absl::Status status;
+    switch (request.kind) {
+      case Kind::kGetContents:
+        status = gxl::GetContents(request.filename, &data, file::Defaults());
+        break;
+      case Kind::kReadRange: {
+        File* f = File::Open(request.filename, "r");
+        if (f == nullptr) {
+          status = absl::ErrnoToStatus(
+              errno, absl::StrCat("Could not open '", request.filename, "'"));
+          break;
+        }
+        data.resize(request.size);
+        const int64_t n = f->PRead(request.offset, data.data(), data.size());
+        if (n < 0) {
+          status = absl::ErrnoToStatus(
+              errno,
+              absl::StrCat("Could not read from '", request.filename, "'"));
+        } else {
+          data.resize(n);
+        }
+        status.Update(f->Close(file::Defaults()));
+        break;
+      }
+      case Kind::kSetContents:
+        status = gxl::SetContents(request.filename, request.contents,
+                                  file::Defaults());
+        break;
+    }
+    Complete(request, std::move(status), std::move(data));
+  }
+
+  internal::ThreadPool pool_;
+};
+
+#ifdef GXL_FILE_HAVE_IO_URING
+
+// Minimal io_uring wrapper on top of the raw syscalls. The submission queue
+// must be externally synchronized; the completion queue has a single
+// consumer.
+class Ring {
+ public:
+  static absl::StatusOr<std::unique_ptr<Ring>> Create(unsigned entries) {
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    const int fd = syscall(__NR_io_uring_setup, entries, &params);
+    if (fd < 0) {
+      return absl::ErrnoToStatus(errno, "io_uring_setup failed");
+    }
+    std::unique_ptr<Ring> ring(new Ring(fd));
+    RETURN_IF_ERROR(ring->Map(params));
+    RETURN_IF_ERROR(ring->Probe());
+    return ring;
+  }
+
+  Ring(const Ring&) = delete;
+  Ring& operator=(const Ring&) = delete;
+
+  ~Ring() {
+    if (sqes_ != nullptr) {
+      munmap(sqes_, sqes_size_);
+    }
+    if (cq_ring_ != nullptr && cq_ring_ != sq_ring_) {
+      munmap(cq_ring_, cq_ring_size_);
+    }
+    if (sq_ring_ != nullptr) {
+      munmap(sq_ring_, sq_ring_size_);
+    }
+    close(fd_);
+  }
+
+  // Returns a zeroed submission queue entry, or nullptr if the queue is full.
+  // The entry is handed to the kernel by the next Publish().
+  struct io_uring_sqe* NextSqe() {
+    const unsigned head = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+    if (sqe_tail_ - head >= sq_entries_) {
+      return nullptr;
+    }
+    const unsigned index = sqe_tail_ & *sq_mask_;
+    sq_array_[index] = index;
+    ++sqe_tail_;
+    struct io_uring_sqe* sqe = &sqes_[index];
+    memset(sqe, 0, sizeof(*sqe));
+    return sqe;
+  }
+
+  void Publish() { __atomic_store_n(sq_tail_, sqe_tail_, __ATOMIC_RELEASE); }
+
+  // Submits up to "to_submit" published entries and waits for at least
+  // "min_complete" completions.
+  absl::Status Enter(unsigned to_submit, unsigned min_complete) {
+    const unsigned flags = min_complete > 0 ? IORING_ENTER_GETEVENTS : 0;
+    while (syscall(__NR_io_uring_enter, fd_, to_submit, min_complete, flags,
+                   nullptr, 0) < 0) {
+      if (errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+        return absl::ErrnoToStatus(errno, "io_uring_enter failed");
+      }
+      if (errno != EINTR) {
+        std::this_thread::yield();
+      }
+    }
+    return absl::OkStatus();
+  }
+
+  // Pops the oldest completion into "cqe". Returns false if there is none.
+  bool PopCqe(struct io_uring_cqe* cqe) {
+    const unsigned head = *cq_head_;
+    if (head == __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE)) {
+      return false;
+    }
+    *cqe = cqes_[head & *cq_mask_];
+    __atomic_store_n(cq_head_, head + 1, __ATOMIC_RELEASE);
+    return true;
+  }
+
+ private:
+  explicit Ring(int fd) : fd_(fd) {}
+
+  absl::Status Map(const struct io_uring_params& params) {
+    sq_entries_ = params.sq_entries;
+    sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_ring_size_ =
+        params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    const bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (single_mmap) {
+      sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+    }
+    sq_ring_ = MapRegion(sq_ring_size_, IORING_OFF_SQ_RING);
+    if (sq_ring_ == nullptr) {
+      return absl::ErrnoToStatus(errno, "Could not map io_uring SQ ring");
+    }
+    cq_ring_ = single_mmap ? sq_ring_
+                           : MapRegion(cq_ring_size_, IORING_OFF_CQ_RING);
+    if (cq_ring_ == nullptr) {
+      return absl::ErrnoToStatus(errno, "Could not map io_uring CQ ring");
+    }
+    sqes_size_ = params.sq_entries * sizeof(struct io_uring_sqe);
+    sqes_ = static_cast<struct io_uring_sqe*>(
+        MapRegion(sqes_size_, IORING_OFF_SQES));
+    if (sqes_ == nullptr) {
+      return absl::ErrnoToStatus(errno, "Could not map io_uring SQEs");
+    }
+
+    char* sq = static_cast<char*>(sq_ring_);
+    sq_head_ = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+    sq_tail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+    sq_mask_ = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    sq_array_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+    sqe_tail_ = *sq_tail_;
+    char* cq = static_cast<char*>(cq_ring_);
+    cq_head_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+    cq_tail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+    cq_mask_ = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<struct io_uring_cqe*>(cq + params.cq_off.cqes);
+    return absl::OkStatus();
+  }
+
+  void* MapRegion(size_t size, off_t offset) {
+    void* region = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE, fd_, offset);
+    return region == MAP_FAILED ? nullptr : region;
+  }
+
+  // Checks that the kernel supports every opcode the engine uses.
+  absl::Status Probe() {
+    constexpr int kNumOps = 256;
+    std::unique_ptr<char[]> buffer(new char[sizeof(struct io_uring_probe) +
+                                            kNumOps * sizeof(
+                                                struct io_uring_probe_op)]());
+    auto* probe = reinterpret_cast<struct io_uring_probe*>(buffer.get());
+    if (syscall(__NR_io_uring_register, fd_, IORING_REGISTER_PROBE, probe,
+                kNumOps) < 0) {
+      return absl::ErrnoToStatus(errno, "io_uring probe failed");
+    }
+    for (const int op : {IORING_OP_NOP, IORING_OP_OPENAT, IORING_OP_STATX,
+                         IORING_OP_READ, IORING_OP_WRITE, IORING_OP_CLOSE}) {
+      if (op > probe->last_op ||
+          !(probe->ops[op].flags & IO_URING_OP_SUPPORTED)) {
+        return absl::UnimplementedError(
+            absl::StrCat("io_uring opcode ", op, " is not supported"));
+      }
+    }
+    return absl::OkStatus();
+  }
+
+  const int fd_;
+  unsigned sq_entries_ = 0;
+  void* sq_ring_ = nullptr;
+  size_t sq_ring_size_ = 0;
+  void* cq_ring_ = nullptr;
+  size_t cq_ring_size_ = 0;
+  struct io_uring_sqe* sqes_ = nullptr;
+  size_t sqes_size_ = 0;
+  unsigned* sq_head_ = nullptr;
+  unsigned* sq_tail_ = nullptr;
+  unsigned* sq_mask_ = nullptr;
+  unsigned* sq_array_ = nullptr;
+  unsigned sqe_tail_ = 0;
+  unsigned* cq_head_ = nullptr;
+  unsigned* cq_tail_ = nullptr;
+  unsigned* cq_mask_ = nullptr;
+  struct io_uring_cqe* cqes_ = nullptr;
+};
+
+// Runs each request as a chain of io_uring operations (open, optionally
+// statx, read or write until done, close), advanced by a completion thread.
+class IoUringEngine : public Engine {
+ public:
+  static absl::StatusOr<std::unique_ptr<Engine>> Create(int queue_depth) {
+    // One extra entry for the shutdown wakeup.
+    ASSIGN_OR_RETURN(std::unique_ptr<Ring> ring, Ring::Create(queue_depth + 1));
+    return std::unique_ptr<Engine>(
+        new IoUringEngine(std::move(ring), queue_depth));
+  }
+
+  ~IoUringEngine() override {
+    {
+      absl::MutexLock lock(&mu_);
+      struct io_uring_sqe* sqe = ring_->NextSqe();
+      CHECK(sqe != nullptr);
+      sqe->opcode = IORING_OP_NOP;
+      sqe->user_data = kShutdownTag;
+      ring_->Publish();
+    }
+    CHECK_OK(ring_->Enter(1, 0));
+    completion_thread_.join();
+  }
+
+  AsyncIO::Backend backend() const override {
+    return AsyncIO::Backend::kIoUring;
+  }
+
+ protected:
+  void Start(std::unique_ptr<Request> request) override {
+    auto op = std::make_unique<Op>();
+    op->request = std::move(request);
+    {
+      absl::MutexLock lock(&mu_);
+      if (in_flight_ >= queue_depth_) {
+        backlog_.push_back(std::move(op));
+        return;
+      }
+      ++in_flight_;
+      PrepareLocked(op.release());
+      ring_->Publish();
+    }
+    CHECK_OK(ring_->Enter(1, 0));
+  }
+
+ private:
+  enum class Step { kOpen, kStat, kRead, kWrite, kClose };
+
+  struct Op {
+    std::unique_ptr<Request> request;
+    Step step = Step::kOpen;
+    int fd = -1;
+    std::string data;
+    size_t done = 0;
+    bool unknown_size = false;  // Read until EOF instead of up to data.size().
+    struct statx stat;
+    absl::Status status;
+  };
+
+  static constexpr uint64_t kShutdownTag = 0;
+  // Initial buffer for files that report a size of 0, e.g. in /proc.
+  static constexpr size_t kUnknownSizeChunk = 64 << 10;
+  // Single read/write requests are capped, like read(2) itself.
+  static constexpr size_t kMaxTransfer = 1 << 30;
+
+  IoUringEngine(std::unique_ptr<Ring> ring, int queue_depth)
+      : ring_(std::move(ring)), queue_depth_(queue_depth) {
+    completion_thread_ = std::thread([this] { CompletionLoop(); });
+  }
+
+  // Queues the submission for the current step of "op".
+  void PrepareLocked(Op* op) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    struct io_uring_sqe* sqe = ring_->NextSqe();
+    // At most one entry per in-flight op, and the ring holds queue_depth_.
+    CHECK(sqe != nullptr);
+    sqe->user_data = reinterpret_cast<uint64_t>(op);
+    const Request& request = *op->request;
+    switch (op->step) {
+      case Step::kOpen:
+        sqe->opcode = IORING_OP_OPENAT;
+        sqe->fd = AT_FDCWD;
+        sqe->addr = reinterpret_cast<uint64_t>(request.filename.c_str());
+        sqe->open_flags =
+            O_CLOEXEC | (request.kind == Kind::kSetContents
+                             ? O_WRONLY | O_CREAT | O_TRUNC
+                             : O_RDONLY);
+        sqe->len = 0666;
+        break;
+      case Step::kStat:
+        sqe->opcode = IORING_OP_STATX;
+        sqe->fd = op->fd;
+        sqe->addr = reinterpret_cast<uint64_t>("");
+        sqe->statx_flags = AT_EMPTY_PATH;
+        sqe->len = STATX_SIZE;
+        sqe->off = reinterpret_cast<uint64_t>(&op->stat);
+        break;
+      case Step::kRead:
+        sqe->opcode = IORING_OP_READ;
+        sqe->fd = op->fd;
+        sqe->addr = reinterpret_cast<uint64_t>(op->data.data() + op->done);
+        sqe->len = std::min(op->data.size() - op->done, kMaxTransfer);
+        sqe->off = request.offset + op->done;
+        break;
+      case Step::kWrite:
+        sqe->opcode = IORING_OP_WRITE;
+        sqe->fd = op->fd;
+        sqe->addr =
+            reinterpret_cast<uint64_t>(request.contents.data() + op->done);
+        sqe->len = std::min(request.contents.size() - op->done, kMaxTransfer);
+        sqe->off = op->done;
+        break;
+      case Step::kClose:
+        sqe->opcode = IORING_OP_CLOSE;
+        sqe->fd = op->fd;
+        break;
+    }
+  }
+
+  // Consumes the result of the current step of "op" and moves it to the next
+  // step. Returns true once the op is finished.
+  static bool Advance(Op* op, int res) {
+    Request& request = *op->request;
+    switch (op->step) {
+      case Step::kOpen:
+        if (res < 0) {
+          op->status = absl::ErrnoToStatus(
+              -res, absl::StrCat("Could not open '", request.filename, "'"));
+          return true;
+        }
+        op->fd = res;
+        if (request.kind == Kind::kGetContents) {
+          op->step = Step::kStat;
+        } else if (request.kind == Kind::kReadRange) {
+          op->data.resize(request.size);
+          op->step = request.size > 0 ? Step::kRead : Step::kClose;
+        } else {
+          op->step =
+              request.contents.empty() ? Step::kClose : Step::kWrite;
+        }
+        return false;
+      case Step::kStat:
+        if (res < 0) {
+          op->status = absl::ErrnoToStatus(
+              -res, absl::StrCat("Could not stat '", request.filename, "'"));
+          op->step = Step::kClose;
+          return false;
+        }
+        op->unknown_size = op->stat.stx_size == 0;
+        op->data.resize(op->unknown_size ? kUnknownSizeChunk
+                                         : op->stat.stx_size);
+        op->step = Step::kRead;
+        return false;
+      case Step::kRead:
+        if (res == -EINTR || res == -EAGAIN) {
+          return false;  // Retry the same read.
+        }
+        if (res < 0) {
+          op->status = absl::ErrnoToStatus(
+              -res,
+              absl::StrCat("Could not read from '", request.filename, "'"));
+          op->step = Step::kClose;
+          return false;
+        }
+        op->done += res;
+        if (res == 0 || (op->done == op->data.size() && !op->unknown_size)) {
+          op->data.resize(op->done);
+          op->step = Step::kClose;
+        } else if (op->done == op->data.size()) {
+          op->data.resize(2 * op->data.size());
+        }
+        return false;
+      case Step::kWrite:
+        if (res == -EINTR || res == -EAGAIN) {
+          return false;
+        }
+        if (res <= 0) {
+          op->status = absl::ErrnoToStatus(
+              res < 0 ? -res : EIO,
+              absl::StrCat("Could not write to '", request.filename, "'"));
+          op->step = Step::kClose;
+          return false;
+        }
+        op->done += res;
+        if (op->done == request.contents.size()) {
+          op->step = Step::kClose;
+        }
+        return false;
+      case Step::kClose:
+        if (res < 0 && op->status.ok()) {
+          op->status = absl::ErrnoToStatus(
+              -res, absl::StrCat("Could not close '", request.filename, "'"));
+        }
+        return true;
+    }
+    return true;
+  }
+
+  void CompletionLoop() {
+    while (true) {
+      unsigned prepared = 0;
+      struct io_uring_cqe cqe;
+      while (ring_->PopCqe(&cqe)) {
+        if (cqe.user_data == kShutdownTag) {
+          return;
+        }
+        Op* op = reinterpret_cast<Op*>(cqe.user_data);
+        if (!Advance(op, cqe.res)) {
+          absl::MutexLock lock(&mu_);
+          PrepareLocked(op);
+          ring_->Publish();
+          ++prepared;
+          continue;
+        }
+        Complete(*op->request, std::move(op->status), std::move(op->data));
+        delete op;
+        absl::MutexLock lock(&mu_);
+        if (backlog_.empty()) {
+          --in_flight_;
+        } else {
+          PrepareLocked(backlog_.front().release());
+          backlog_.pop_front();
+          ring_->Publish();
+          ++prepared;
+        }
+      }
+      CHECK_OK(ring_->Enter(prepared, 1));
+    }
+  }
+
+  const std::unique_ptr<Ring> ring_;
+  const int queue_depth_;
+  absl::Mutex mu_;
+  int in_flight_ ABSL_GUARDED_BY(mu_) = 0;
+  std::deque<std::unique_ptr<Op>> backlog_ ABSL_GUARDED_BY(mu_);
+  std::thread completion_thread_;
+};
+
+#endif  // GXL_FILE_HAVE_IO_URING
+
+template <typename T>
+absl::AnyInvocable<void(T)> Fulfill(std::promise<T>* promise) {
+  return [promise = std::move(*promise)](T result) mutable {
+    promise.set_value(std::move(result));
+  };
+}
+
+}  // namespace
+
+absl::StatusOr<std::unique_ptr<AsyncIO>> AsyncIO::Create() {
+  return Create(Options());
+}
+
+absl::StatusOr<std::unique_ptr<AsyncIO>> AsyncIO::Create(
+    const Options& options) {
+  if (options.queue_depth <= 0) {
+    return absl::InvalidArgumentError("queue_depth must be positive");
+  }
+#ifdef GXL_FILE_HAVE_IO_URING
+  if (options.use_io_uring) {
+    absl::StatusOr<std::unique_ptr<Engine>> engine =
+        IoUringEngine::Create(options.queue_depth);
+    if (engine.ok()) {
+      return std::unique_ptr<AsyncIO>(new AsyncIO(*std::move(engine)));
+    }
+    LOG(INFO) << "io_uring unavailable, using a thread pool: "
+              << engine.status();
+  }
+#endif  // GXL_FILE_HAVE_IO_URING
+  return std::unique_ptr<AsyncIO>(
+      new AsyncIO(std::make_unique<ThreadPoolEngine>(options.num_threads,
+                                                     options.queue_depth)));
+}
+
+AsyncIO::AsyncIO(std::unique_ptr<Engine> engine) : engine_(std::move(engine)) {}
+
+AsyncIO::~AsyncIO() { engine_->Wait(); }
+
+AsyncIO::Backend AsyncIO::backend() const { return engine_->backend(); }
+
+void AsyncIO::GetContents(absl::string_view filename, ReadCallback done) {
+  auto request = std::make_unique<Engine::Request>();
+  request->kind = Engine::Kind::kGetContents;
+  request->filename = std::string(filename);
+  request->read_done = std::move(done);
+  engine_->Submit(std::move(request));
+}
+
+std::future<absl::StatusOr<std::string>> AsyncIO::GetContents(
+    absl::string_view filename) {
+  std::promise<absl::StatusOr<std::string>> promise;
+  std::future<absl::StatusOr<std::string>> result = promise.get_future();
+  GetContents(filename, Fulfill(&promise));
+  return result;
+}
+
+void AsyncIO::ReadRange(absl::string_view filename, uint64_t offset,
+                        size_t size, ReadCallback done) {
+  auto request = std::make_unique<Engine::Request>();
+  request->kind = Engine::Kind::kReadRange;
+  request->filename = std::string(filename);
+  request->offset = offset;
+  request->size = size;
+  request->read_done = std::move(done);
+  engine_->Submit(std::move(request));
+}
+
+std::future<absl::StatusOr<std::string>> AsyncIO::ReadRange(
+    absl::string_view filename, uint64_t offset, size_t size) {
+  std::promise<absl::StatusOr<std::string>> promise;
+  std::future<absl::StatusOr<std::string>> result = promise.get_future();
+  ReadRange(filename, offset, size, Fulfill(&promise));
+  return result;
+}
+
+void AsyncIO::SetContents(absl::string_view filename, std::string contents,
+                          WriteCallback done) {
+  auto request = std::make_unique<Engine::Request>();
+  request->kind = Engine::Kind::kSetContents;
+  request->filename = std::string(filename);
+  request->contents = std::move(contents);
+  request->write_done = std::move(done);
+  engine_->Submit(std::move(request));
+}
+
+std::future<absl::Status> AsyncIO::SetContents(absl::string_view filename,
+                                               std::string contents) {
+  std::promise<absl::Status> promise;
+  std::future<absl::Status> result = promise.get_future();
+  SetContents(filename, std::move(contents), Fulfill(&promise));
+  return result;
+}
+
+void AsyncIO::Wait() { engine_->Wait(); }
+
+}  // namespace gxl
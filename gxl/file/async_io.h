@@ -0,0 +1,122 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GXL_FILE_ASYNC_IO_H_
+#define GXL_FILE_ASYNC_IO_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <future>  // NOLINT
+#include <memory>
+#include <string>
+
+#include "absl/functional/any_invocable.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+
+namespace gxl {
+
+// Asynchronous whole-file and ranged I/O, for loaders that touch many files
+// or many regions at once and would otherwise be bound by the latency of one
+// blocking syscall after another.
+//
+// On Linux the operations run on an io_uring: open, stat, read/write and close
+// are all submitted to the kernel, so thousands of files can be in flight
+// from a single thread. Elsewhere, or when io_uring is unavailable or
+// disabled, they run as blocking calls on a thread pool.
+//
+// Usage:
+//
+//   ASSIGN_OR_RETURN(std::unique_ptr<AsyncIO> io, AsyncIO::Create());
+//   std::vector<std::future<absl::StatusOr<std::string>>> pending;
+//   for (const std::string& filename : filenames) {
+//     pending.push_back(io->GetContents(filename));
+//   }
+//   for (auto& contents : pending) {
+//     ASSIGN_OR_RETURN(std::string data, contents.get());
+//     ...
+//   }
+//
+// All methods are thread-safe. Callbacks run on an internal thread and must
+// not block; in particular they must not call Wait(). They may submit more
+// operations.
+class AsyncIO {
+ public:
+  enum class Backend {
+    kIoUring,
+    kThreadPool,
+  };
+
+  struct Options {
+    // Maximum number of operations in flight at once. Further submissions are
+    // queued until earlier ones complete.
+    int queue_depth = 256;
+
+    // Number of threads for the thread pool backend. 0 means one per CPU.
+    // At most queue_depth of them are started.
+    int num_threads = 0;
+
+    // Set to false to force the thread pool backend.
+    bool use_io_uring = true;
+  };
+
+  using ReadCallback = absl::AnyInvocable<void(absl::StatusOr<std::string>)>;
+  using WriteCallback = absl::AnyInvocable<void(absl::Status)>;
+
+  static absl::StatusOr<std::unique_ptr<AsyncIO>> Create();
+  static absl::StatusOr<std::unique_ptr<AsyncIO>> Create(
+      const Options& options);
+
+  AsyncIO(const AsyncIO&) = delete;
+  AsyncIO& operator=(const AsyncIO&) = delete;
+
+  // Waits for all outstanding operations to complete.
+  ~AsyncIO();
+
+  Backend backend() const;
+
+  // Reads the whole file "filename", like gxl::GetContents().
+  void GetContents(absl::string_view filename, ReadCallback done);
+  std::future<absl::StatusOr<std::string>> GetContents(
+      absl::string_view filename);
+
+  // Reads up to "size" bytes of "filename" starting at "offset". The result
+  // is shorter than "size" only if the file ends first.
+  void ReadRange(absl::string_view filename, uint64_t offset, size_t size,
+                 ReadCallback done);
+  std::future<absl::StatusOr<std::string>> ReadRange(
+      absl::string_view filename, uint64_t offset, size_t size);
+
+  // Replaces the contents of "filename", like gxl::SetContents().
+  void SetContents(absl::string_view filename, std::string contents,
+                   WriteCallback done);
+  std::future<absl::Status> SetContents(absl::string_view filename,
+                                        std::string contents);
+
+  // Blocks until every operation submitted so far has completed and its
+  // callback has returned.
+  void Wait();
+
+  // Implementation interface, defined in async_io.cc.
+  class Engine;
+
+ private:
+  explicit AsyncIO(std::unique_ptr<Engine> engine);
+
+  std::unique_ptr<Engine> engine_;
+};
+
+}  // namespace gxl
+
+#endif  // GXL_FILE_ASYNC_IO_H_
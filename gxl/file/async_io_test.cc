@@ -0,0 +1,165 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gxl/file/async_io.h"
+
+#include <atomic>
+#include <future>  // NOLINT
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_replace.h"
+#include "absl/strings/string_view.h"
+#include "gtest/gtest.h"
+#include "gxl/file/file.h"
+
+namespace gxl {
+namespace {
+
+std::string TestFile(absl::string_view name) {
+  return absl::StrCat(testing::TempDir(), "/", name);
+}
+
+// Runs each test against both backends. The io_uring variant is skipped when
+// the kernel or the sandbox does not allow io_uring.
+class AsyncIOTest : public testing::TestWithParam<AsyncIO::Backend> {
+ protected:
+  void SetUp() override {
+    AsyncIO::Options options;
+    options.queue_depth = 4;
+    options.num_threads = 2;
+    options.use_io_uring = GetParam() == AsyncIO::Backend::kIoUring;
+    absl::StatusOr<std::unique_ptr<AsyncIO>> io = AsyncIO::Create(options);
+    ASSERT_TRUE(io.ok()) << io.status();
+    io_ = *std::move(io);
+    if (io_->backend() != GetParam()) {
+      GTEST_SKIP() << "io_uring is not available";
+    }
+  }
+
+  // Returns a file name unique to the test and backend.
+  std::string Filename(absl::string_view name) {
+    return TestFile(absl::StrCat(
+        "async_io_",
+        absl::StrReplaceAll(
+            testing::UnitTest::GetInstance()->current_test_info()->name(),
+            {{"/", "_"}}),
+        "_", name));
+  }
+
+  std::unique_ptr<AsyncIO> io_;
+};
+
+TEST_P(AsyncIOTest, SetContentsThenGetContents) {
+  const std::string filename = Filename("file");
+  const std::string contents(100000, 'x');
+  ASSERT_TRUE(io_->SetContents(filename, contents).get().ok());
+  absl::StatusOr<std::string> read = io_->GetContents(filename).get();
+  ASSERT_TRUE(read.ok()) << read.status();
+  EXPECT_EQ(*read, contents);
+}
+
+TEST_P(AsyncIOTest, GetContentsOfEmptyFile) {
+  const std::string filename = Filename("empty");
+  ASSERT_TRUE(SetContents(filename, "", file::Defaults()).ok());
+  absl::StatusOr<std::string> read = io_->GetContents(filename).get();
+  ASSERT_TRUE(read.ok()) << read.status();
+  EXPECT_EQ(*read, "");
+}
+
+TEST_P(AsyncIOTest, GetContentsOfMissingFile) {
+  // The thread pool backend reports the code of gxl::GetContents(), which
+  // differs from the errno-based one of the ring.
+  absl::StatusOr<std::string> read =
+      io_->GetContents(Filename("missing")).get();
+  EXPECT_FALSE(read.ok());
+}
+
+TEST_P(AsyncIOTest, ReadRange) {
+  const std::string filename = Filename("range");
+  ASSERT_TRUE(SetContents(filename, "hello world", file::Defaults()).ok());
+  absl::StatusOr<std::string> read = io_->ReadRange(filename, 6, 5).get();
+  ASSERT_TRUE(read.ok()) << read.status();
+  EXPECT_EQ(*read, "world");
+}
+
+TEST_P(AsyncIOTest, ShortReadRange) {
+  const std::string filename = Filename("short");
+  ASSERT_TRUE(SetContents(filename, "hello world", file::Defaults()).ok());
+  // A range that runs past the end of the file returns what is there.
+  absl::StatusOr<std::string> read = io_->ReadRange(filename, 6, 100).get();
+  ASSERT_TRUE(read.ok()) << read.status();
+  EXPECT_EQ(*read, "world");
+  read = io_->ReadRange(filename, 100, 10).get();
+  ASSERT_TRUE(read.ok()) << read.status();
+  EXPECT_EQ(*read, "");
+}
+
+TEST_P(AsyncIOTest, ReadRangeOfMissingFile) {
+  absl::StatusOr<std::string> read =
+      io_->ReadRange(Filename("missing"), 0, 10).get();
+  EXPECT_EQ(read.status().code(), absl::StatusCode::kNotFound);
+}
+
+TEST_P(AsyncIOTest, SetContentsInMissingDirectory) {
+  EXPECT_FALSE(io_->SetContents(Filename("missing/file"), "data").get().ok());
+}
+
+TEST_P(AsyncIOTest, MoreRequestsThanQueueDepth) {
+  constexpr int kNumFiles = 50;
+  std::vector<std::future<absl::Status>> writes;
+  for (int i = 0; i < kNumFiles; ++i) {
+    writes.push_back(io_->SetContents(Filename(absl::StrCat(i)),
+                                      std::string(i * 1000, 'a' + i % 26)));
+  }
+  for (auto& write : writes) {
+    ASSERT_TRUE(write.get().ok());
+  }
+
+  std::atomic<int> num_ok = 0;
+  for (int i = 0; i < kNumFiles; ++i) {
+    io_->GetContents(Filename(absl::StrCat(i)),
+                     [&num_ok, i](absl::StatusOr<std::string> read) {
+                       if (read.ok() &&
+                           *read == std::string(i * 1000, 'a' + i % 26)) {
+                         ++num_ok;
+                       }
+                     });
+  }
+  io_->Wait();
+  EXPECT_EQ(num_ok, kNumFiles);
+}
+
+INSTANTIATE_TEST_SUITE_P(Backends, AsyncIOTest,
+                         testing::Values(AsyncIO::Backend::kIoUring,
+                                         AsyncIO::Backend::kThreadPool),
+                         [](const testing::TestParamInfo<AsyncIO::Backend>&
+                                info) {
+                           return info.param == AsyncIO::Backend::kIoUring
+                                      ? "IoUring"
+                                      : "ThreadPool";
+                         });
+
+TEST(AsyncIOCreateTest, RejectsNonPositiveQueueDepth) {
+  AsyncIO::Options options;
+  options.queue_depth = 0;
+  EXPECT_EQ(AsyncIO::Create(options).status().code(),
+            absl::StatusCode::kInvalidArgument);
+}
+
+}  // namespace
+}  // namespace gxl
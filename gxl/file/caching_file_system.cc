@@ -0,0 +1,157 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gxl/file/caching_file_system.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "absl/synchronization/mutex.h"
+
+namespace gxl {
+
+CachingFileSystem::CachingFileSystem(FileSystem* base, const Options& options)
+    : base_(base), options_(options) {}
+
+std::shared_ptr<const std::string> CachingFileSystem::Lookup(
+    absl::string_view path, uint64_t* generation) {
+  absl::MutexLock lock(&mu_);
+  const auto it = entries_.find(path);
+  if (it == entries_.end()) {
+    ++misses_;
+    *generation = generation_;
+    return nullptr;
+  }
+  ++hits_;
+  lru_.splice(lru_.begin(), lru_, it->second.lru_position);
+  return it->second.contents;
+}
+
+void CachingFileSystem::InsertRead(absl::string_view path,
+                                   std::shared_ptr<const std::string> contents,
+                                   uint64_t generation) {
+  absl::MutexLock lock(&mu_);
+  if (generation == generation_) {
+    InsertLocked(path, std::move(contents));
+  }
+}
+
+uint64_t CachingFileSystem::StartMutation(absl::string_view path) {
+  absl::MutexLock lock(&mu_);
+  EraseLocked(path);
+  return ++generation_;
+}
+
+void CachingFileSystem::FinishMutation(
+    absl::string_view path, std::shared_ptr<const std::string> contents,
+    uint64_t generation) {
+  absl::MutexLock lock(&mu_);
+  const bool concurrent = generation != generation_;
+  // Also invalidates the reads that started during the mutation.
+  ++generation_;
+  if (contents == nullptr || concurrent) {
+    EraseLocked(path);
+  } else {
+    InsertLocked(path, std::move(contents));
+  }
+}
+
+void CachingFileSystem::InsertLocked(
+    absl::string_view path, std::shared_ptr<const std::string> contents) {
+  EraseLocked(path);
+  if (contents->size() > options_.max_bytes) {
+    return;
+  }
+  bytes_ += contents->size();
+  lru_.emplace_front(path);
+  entries_[path] = Entry{std::move(contents), lru_.begin()};
+  while (bytes_ > options_.max_bytes) {
+    EraseLocked(lru_.back());
+  }
+}
+
+void CachingFileSystem::EraseLocked(absl::string_view path) {
+  const auto it = entries_.find(path);
+  if (it == entries_.end()) {
+    return;
+  }
+  bytes_ -= it->second.contents->size();
+  lru_.erase(it->second.lru_position);  // Invalidates "path" if it is a key.
+  entries_.erase(it);
+}
+
+absl::Status CachingFileSystem::GetContents(absl::string_view path,
+                                            std::string* output) {
+  uint64_t generation;
+  if (std::shared_ptr<const std::string> contents =
+          Lookup(path, &generation)) {
+    output->assign(*contents);
+    return absl::OkStatus();
+  }
+  absl::Status status = base_->GetContents(path, output);
+  if (status.ok()) {
+    InsertRead(path, std::make_shared<const std::string>(*output), generation);
+  }
+  return status;
+}
+
+absl::Status CachingFileSystem::SetContents(absl::string_view path,
+                                            absl::string_view contents) {
+  const uint64_t generation = StartMutation(path);
+  absl::Status status = base_->SetContents(path, contents);
+  // On error, the file may have been partially written.
+  FinishMutation(path,
+                 status.ok() ? std::make_shared<const std::string>(contents)
+                             : nullptr,
+                 generation);
+  return status;
+}
+
+absl::Status CachingFileSystem::Exists(absl::string_view path) {
+  {
+    absl::MutexLock lock(&mu_);
+    if (entries_.contains(path)) {
+      return absl::OkStatus();
+    }
+  }
+  return base_->Exists(path);
+}
+
+absl::Status CachingFileSystem::Delete(absl::string_view path) {
+  // Erases before and after deleting: a concurrent read of the old file then
+  // sees a newer generation and is not cached.
+  const uint64_t generation = StartMutation(path);
+  absl::Status status = base_->Delete(path);
+  FinishMutation(path, nullptr, generation);
+  return status;
+}
+
+absl::Status CachingFileSystem::RecursivelyCreateDir(absl::string_view path) {
+  return base_->RecursivelyCreateDir(path);
+}
+
+int64_t CachingFileSystem::hits() const {
+  absl::MutexLock lock(&mu_);
+  return hits_;
+}
+
+int64_t CachingFileSystem::misses() const {
+  absl::MutexLock lock(&mu_);
+  return misses_;
+}
+
+}  // namespace gxl
@@ -0,0 +1,124 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GXL_FILE_CACHING_FILE_SYSTEM_H_
+#define GXL_FILE_CACHING_FILE_SYSTEM_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "absl/synchronization/mutex.h"
+#include "gxl/file/vfs.h"
+
+namespace gxl {
+
+// A file system keeping the contents of recently used files of another one in
+// memory, so that repeated reads cost no I/O.
+//
+// Writes and deletions go through to the underlying file system and update
+// the cache; a write overlapping another write or deletion is not cached,
+// since its result is unknown. Changes made to the underlying file system by
+// other means are not seen until the file is evicted, so the overlay suits
+// data that only changes through it, such as configuration read on every
+// request. Paths are compared as strings: "a/b" and "a//b" are cached
+// separately.
+//
+// Usage, serving the local file system from "cached://":
+//
+//   static CachingFileSystem* const cached_fs =
+//       new CachingFileSystem(LocalFileSystem(), {.max_bytes = 64 << 20});
+//   CHECK_OK(RegisterFileSystem("cached", cached_fs));
+//   ASSIGN_OR_RETURN(std::string config,
+//                    GetContents("cached:///etc/app/config",
+//                                file::Defaults()));
+class CachingFileSystem : public FileSystem {
+ public:
+  struct Options {
+    // The least recently used files are evicted beyond this total size.
+    // Larger files are not cached at all.
+    size_t max_bytes = 256 << 20;
+  };
+
+  // "base" is not owned and must outlive the CachingFileSystem.
+  CachingFileSystem(FileSystem* base, const Options& options);
+
+  CachingFileSystem(const CachingFileSystem&) = delete;
+  CachingFileSystem& operator=(const CachingFileSystem&) = delete;
+
+  absl::Status GetContents(absl::string_view path,
+                           std::string* output) override;
+  absl::Status SetContents(absl::string_view path,
+                           absl::string_view contents) override;
+  absl::Status Exists(absl::string_view path) override;
+  absl::Status Delete(absl::string_view path) override;
+  absl::Status RecursivelyCreateDir(absl::string_view path) override;
+
+  // Number of GetContents() calls served from memory, or not.
+  int64_t hits() const;
+  int64_t misses() const;
+
+ private:
+  struct Entry {
+    std::shared_ptr<const std::string> contents;
+    std::list<std::string>::iterator lru_position;
+  };
+
+  // Returns the cached contents of "path", or nullptr and the generation to
+  // pass to InsertRead().
+  std::shared_ptr<const std::string> Lookup(absl::string_view path,
+                                            uint64_t* generation);
+
+  // Caches contents read from the underlying file system, unless a write or
+  // deletion happened since Lookup() returned "generation": the contents
+  // could be stale then.
+  void InsertRead(absl::string_view path,
+                  std::shared_ptr<const std::string> contents,
+                  uint64_t generation);
+
+  // Brackets a write or deletion of "path" in the underlying file system.
+  // StartMutation() drops the cached contents and returns the generation to
+  // pass to FinishMutation(), which caches "contents" if not null and no
+  // other write or deletion started in between. Otherwise the file system
+  // may hold either one's result, so nothing is cached.
+  uint64_t StartMutation(absl::string_view path);
+  void FinishMutation(absl::string_view path,
+                      std::shared_ptr<const std::string> contents,
+                      uint64_t generation);
+
+  void InsertLocked(absl::string_view path,
+                    std::shared_ptr<const std::string> contents)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void EraseLocked(absl::string_view path) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  FileSystem* const base_;
+  const Options options_;
+
+  mutable absl::Mutex mu_;
+  absl::flat_hash_map<std::string, Entry> entries_ ABSL_GUARDED_BY(mu_);
+  std::list<std::string> lru_ ABSL_GUARDED_BY(mu_);  // Most recent first.
+  size_t bytes_ ABSL_GUARDED_BY(mu_) = 0;
+  uint64_t generation_ ABSL_GUARDED_BY(mu_) = 0;  // Writes and deletions.
+  int64_t hits_ ABSL_GUARDED_BY(mu_) = 0;
+  int64_t misses_ ABSL_GUARDED_BY(mu_) = 0;
+};
+
+}  // namespace gxl
+
+#endif  // GXL_FILE_CACHING_FILE_SYSTEM_H_
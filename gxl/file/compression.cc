@@ -0,0 +1,610 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gxl/file/compression.h"
+
+#include <errno.h>
+#include <sys/types.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/match.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "gxl/file/internal/compression_hooks.h"
+#include "gxl/file/internal/thread_pool.h"
+#include "gxl/status/status_macros.h"
+#include "zlib.h"
+#include "zstd.h"
+
+namespace gxl {
+namespace {
+
+// zlib counts bytes in 32 bits.
+constexpr size_t kMaxBlockSize = size_t{1} << 30;
+
+// A stream opened for writing buffers a block per thread, but no more than
+// this, unless a single block is larger.
+constexpr size_t kMaxWriteBufferSize = size_t{64} << 20;
+
+constexpr absl::string_view kGzipMagic("\x1f\x8b", 2);
+constexpr absl::string_view kZstdMagic("\x28\xb5\x2f\xfd", 4);
+
+absl::Status ZlibError(absl::string_view what, const z_stream& stream,
+                       int code) {
+  return absl::Status(
+      absl::StatusCode::kDataLoss,
+      absl::StrCat(what, " failed: ",
+                   stream.msg != nullptr ? stream.msg : "", " (", code, ")"));
+}
+
+absl::Status ZstdError(absl::string_view what, size_t code) {
+  return absl::Status(absl::StatusCode::kDataLoss,
+                      absl::StrCat(what, " failed: ",
+                                   ZSTD_getErrorName(code)));
+}
+
+// Appends "input" compressed as one gzip member to "*output".
+absl::Status GzipBlock(absl::string_view input, int level,
+                       std::string* output) {
+  z_stream stream = {};
+  int code = deflateInit2(&stream, level == 0 ? Z_DEFAULT_COMPRESSION : level,
+                          Z_DEFLATED, MAX_WBITS + 16, 8, Z_DEFAULT_STRATEGY);
+  if (code != Z_OK) {
+    return ZlibError("deflateInit2", stream, code);
+  }
+  const size_t old_size = output->size();
+  output->resize(old_size + deflateBound(&stream, input.size()));
+  stream.next_in =
+      reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+  stream.avail_in = input.size();
+  stream.next_out = reinterpret_cast<Bytef*>(output->data() + old_size);
+  stream.avail_out = output->size() - old_size;
+  code = deflate(&stream, Z_FINISH);
+  output->resize(old_size + stream.total_out);
+  deflateEnd(&stream);
+  if (code != Z_STREAM_END) {
+    return ZlibError("deflate", stream, code);
+  }
+  return absl::OkStatus();
+}
+
+// Appends "input" compressed as one zstd frame to "*output".
+absl::Status ZstdBlock(absl::string_view input, int level,
+                       std::string* output) {
+  const size_t old_size = output->size();
+  output->resize(old_size + ZSTD_compressBound(input.size()));
+  const size_t size =
+      ZSTD_compress(output->data() + old_size, output->size() - old_size,
+                    input.data(), input.size(), level);
+  if (ZSTD_isError(size)) {
+    output->resize(old_size);
+    return ZstdError("ZSTD_compress", size);
+  }
+  output->resize(old_size + size);
+  return absl::OkStatus();
+}
+
+absl::Status CompressBlock(absl::string_view input,
+                           const CompressionOptions& options,
+                           std::string* output) {
+  switch (options.compression) {
+    case Compression::kNone:
+      output->append(input.data(), input.size());
+      return absl::OkStatus();
+    case Compression::kGzip:
+      return GzipBlock(input, options.level, output);
+    case Compression::kZstd:
+      return ZstdBlock(input, options.level, output);
+  }
+  return absl::Status(absl::StatusCode::kInvalidArgument,
+                      "Unknown compression");
+}
+
+size_t BlockSize(const CompressionOptions& options) {
+  return std::clamp<size_t>(options.block_size, 1, kMaxBlockSize);
+}
+
+// Sets "*blocks" to "input" compressed, as pieces to be concatenated, several
+// at a time. Empty input gives one empty block, so that the output is a valid
+// compressed stream.
+absl::Status CompressBlocks(absl::string_view input,
+                            const CompressionOptions& options,
+                            std::vector<std::string>* blocks) {
+  blocks->clear();
+  const size_t block_size = BlockSize(options);
+  if (input.size() <= block_size || options.compression == Compression::kNone) {
+    return CompressBlock(input, options, &blocks->emplace_back());
+  }
+  blocks->resize((input.size() + block_size - 1) / block_size);
+  absl::Status status = internal::ParallelFor(
+      blocks->size(), options.num_threads, [&](size_t block) {
+        return CompressBlock(input.substr(block * block_size, block_size),
+                             options, &(*blocks)[block]);
+      });
+  if (!status.ok()) {
+    blocks->clear();
+  }
+  return status;
+}
+
+// Appends "input" compressed to "*output".
+absl::Status AppendCompressed(absl::string_view input,
+                              const CompressionOptions& options,
+                              std::string* output) {
+  if (input.size() <= BlockSize(options) ||
+      options.compression == Compression::kNone) {
+    return CompressBlock(input, options, output);
+  }
+  std::vector<std::string> blocks;
+  RETURN_IF_ERROR(CompressBlocks(input, options, &blocks));
+  size_t size = output->size();
+  for (const std::string& block : blocks) {
+    size += block.size();
+  }
+  output->reserve(size);
+  for (const std::string& block : blocks) {
+    output->append(block);
+  }
+  return absl::OkStatus();
+}
+
+// Incremental decompression of a sequence of gzip members or zstd frames.
+class Decoder {
+ public:
+  static std::unique_ptr<Decoder> Create(Compression compression);
+
+  virtual ~Decoder() = default;
+
+  // Decompresses from "*input" into "out", of "out_size" bytes, removing what
+  // was consumed from "*input" and setting "*produced". Output held back
+  // from earlier calls is returned even if "*input" is empty.
+  virtual absl::Status Decode(absl::string_view* input, char* out,
+                              size_t out_size, size_t* produced) = 0;
+
+  // Returns an error if the input ended within a member or frame.
+  absl::Status Finish() const {
+    if (in_block_) {
+      return absl::Status(absl::StatusCode::kDataLoss,
+                          "Truncated compressed data");
+    }
+    return absl::OkStatus();
+  }
+
+ protected:
+  bool in_block_ = false;
+};
+
+class GzipDecoder : public Decoder {
+ public:
+  GzipDecoder() {
+    // Only fails for lack of memory, which the first inflate() reports.
+    inflateInit2(&stream_, MAX_WBITS + 16);
+  }
+
+  ~GzipDecoder() override { inflateEnd(&stream_); }
+
+  absl::Status Decode(absl::string_view* input, char* out, size_t out_size,
+                      size_t* produced) override {
+    *produced = 0;
+    while (*produced < out_size) {
+      if (!in_block_ && !input->empty()) {
+        // Starts the next member of a multi-member file.
+        if (started_ && inflateReset(&stream_) != Z_OK) {
+          return ZlibError("inflateReset", stream_, Z_STREAM_ERROR);
+        }
+        started_ = true;
+        in_block_ = true;
+      }
+      stream_.next_in =
+          reinterpret_cast<Bytef*>(const_cast<char*>(input->data()));
+      stream_.avail_in = std::min(input->size(), kMaxBlockSize);
+      stream_.next_out = reinterpret_cast<Bytef*>(out + *produced);
+      stream_.avail_out = std::min(out_size - *produced, kMaxBlockSize);
+      const uInt avail_in = stream_.avail_in;
+      const uInt avail_out = stream_.avail_out;
+      const int code = in_block_ ? inflate(&stream_, Z_NO_FLUSH) : Z_BUF_ERROR;
+      input->remove_prefix(avail_in - stream_.avail_in);
+      *produced += avail_out - stream_.avail_out;
+      if (code == Z_STREAM_END) {
+        in_block_ = false;
+      } else if (code == Z_BUF_ERROR) {
+        return absl::OkStatus();  // No progress possible.
+      } else if (code != Z_OK) {
+        return ZlibError("inflate", stream_, code);
+      } else if (avail_in == stream_.avail_in &&
+                 avail_out == stream_.avail_out) {
+        return absl::OkStatus();
+      }
+    }
+    return absl::OkStatus();
+  }
+
+ private:
+  z_stream stream_ = {};
+  bool started_ = false;
+};
+
+class ZstdDecoder : public Decoder {
+ public:
+  ZstdDecoder() : context_(ZSTD_createDStream()) {}
+
+  ~ZstdDecoder() override { ZSTD_freeDStream(context_); }
+
+  absl::Status Decode(absl::string_view* input, char* out, size_t out_size,
+                      size_t* produced) override {
+    if (context_ == nullptr) {
+      return absl::Status(absl::StatusCode::kResourceExhausted,
+                          "ZSTD_createDStream failed");
+    }
+    ZSTD_inBuffer in = {input->data(), input->size(), 0};
+    ZSTD_outBuffer output = {out, out_size, 0};
+    // A frame can end with output held back, so call until no progress.
+    while (output.pos < output.size) {
+      const size_t old_in = in.pos, old_out = output.pos;
+      const size_t code = ZSTD_decompressStream(context_, &output, &in);
+      if (ZSTD_isError(code)) {
+        input->remove_prefix(in.pos);
+        *produced = output.pos;
+        return ZstdError("ZSTD_decompressStream", code);
+      }
+      if (in.pos > old_in) {
+        in_block_ = true;
+      }
+      if (code == 0) {
+        in_block_ = false;
+      }
+      if (in.pos == old_in && output.pos == old_out) {
+        break;
+      }
+    }
+    input->remove_prefix(in.pos);
+    *produced = output.pos;
+    return absl::OkStatus();
+  }
+
+ private:
+  ZSTD_DStream* const context_;
+};
+
+std::unique_ptr<Decoder> Decoder::Create(Compression compression) {
+  switch (compression) {
+    case Compression::kGzip:
+      return std::make_unique<GzipDecoder>();
+    case Compression::kZstd:
+      return std::make_unique<ZstdDecoder>();
+    case Compression::kNone:
+      break;
+  }
+  return nullptr;
+}
+
+#ifndef _WIN32
+
+// The state behind a stream returned by OpenStream().
+class CompressedStream {
+ public:
+  static constexpr size_t kReadBufferSize = 256 << 10;
+
+  // Reading, of data that is not compressed if "decoder" is null.
+  CompressedStream(FILE* file, std::unique_ptr<Decoder> decoder)
+      : file_(file), writing_(false), decoder_(std::move(decoder)) {}
+
+  // Writing.
+  CompressedStream(FILE* file, const CompressionOptions& options)
+      : file_(file), writing_(true), options_(options) {
+    if (options_.num_threads <= 0) {
+      options_.num_threads = internal::ThreadPool::DefaultNumThreads();
+    }
+    options_.block_size = BlockSize(options);
+    const size_t blocks = std::max<size_t>(
+        1, std::min<size_t>(options_.num_threads,
+                            kMaxWriteBufferSize / options_.block_size));
+    flush_size_ = blocks * options_.block_size;
+  }
+
+  // "prefix" is what was read from the file to detect its compression.
+  void set_read_buffer(std::string prefix) {
+    buffer_ = std::move(prefix);
+    buffer_.reserve(kReadBufferSize);
+    input_ = buffer_;
+  }
+
+  ssize_t Read(char* out, size_t size) {
+    while (true) {
+      if (input_.empty() && !eof_) {
+        buffer_.resize(kReadBufferSize);
+        const size_t n = fread(buffer_.data(), 1, buffer_.size(), file_);
+        if (n == 0) {
+          if (ferror(file_)) {
+            return -1;
+          }
+          eof_ = true;
+        }
+        input_ = absl::string_view(buffer_.data(), n);
+      }
+      const size_t input_size = input_.size();
+      size_t produced = 0;
+      if (decoder_ == nullptr) {
+        produced = std::min(size, input_.size());
+        memcpy(out, input_.data(), produced);
+        input_.remove_prefix(produced);
+      } else if (!decoder_->Decode(&input_, out, size, &produced).ok()) {
+        errno = EIO;
+        return -1;
+      }
+      if (produced > 0 || size == 0) {
+        return produced;
+      }
+      if (!input_.empty() && input_.size() == input_size) {
+        errno = EIO;  // The decoder is stuck.
+        return -1;
+      }
+      if (eof_ && input_.empty()) {
+        if (decoder_ != nullptr && !decoder_->Finish().ok()) {
+          errno = EIO;
+          return -1;
+        }
+        return 0;
+      }
+    }
+  }
+
+  // Compresses once a block for each thread is buffered, or
+  // kMaxWriteBufferSize.
+  ssize_t Write(const char* data, size_t size) {
+    buffer_.append(data, size);
+    if (buffer_.size() >= flush_size_ && !Flush()) {
+      return -1;
+    }
+    return size;
+  }
+
+  // Returns 0 or EOF like fclose(), and deletes this.
+  int Close() {
+    int result = 0;
+    if (writing_ && (!buffer_.empty() || !wrote_)) {
+      if (!Flush()) {
+        result = EOF;
+      }
+    }
+    if (fclose(file_) != 0) {
+      result = EOF;
+    }
+    delete this;
+    return result;
+  }
+
+ private:
+  // Writes the compressed blocks one by one rather than concatenating them.
+  bool Flush() {
+    std::vector<std::string> blocks;
+    if (!CompressBlocks(buffer_, options_, &blocks).ok()) {
+      errno = EIO;
+      return false;
+    }
+    buffer_.clear();
+    wrote_ = true;
+    for (const std::string& block : blocks) {
+      if (fwrite(block.data(), 1, block.size(), file_) != block.size()) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  FILE* const file_;
+  const bool writing_;
+  std::unique_ptr<Decoder> decoder_;
+  CompressionOptions options_;
+  size_t flush_size_ = 0;  // When writing.
+  std::string buffer_;
+  absl::string_view input_;  // Unread part of buffer_.
+  bool eof_ = false;
+  bool wrote_ = false;
+};
+
+#if defined(__APPLE__) || defined(__FreeBSD__)
+
+int ReadStream(void* cookie, char* buffer, int size) {
+  return static_cast<CompressedStream*>(cookie)->Read(buffer, size);
+}
+
+int WriteStream(void* cookie, const char* buffer, int size) {
+  return static_cast<CompressedStream*>(cookie)->Write(buffer, size);
+}
+
+int CloseStream(void* cookie) {
+  return static_cast<CompressedStream*>(cookie)->Close();
+}
+
+FILE* WrapStream(CompressedStream* stream, bool write) {
+  return funopen(stream, write ? nullptr : ReadStream,
+                 write ? WriteStream : nullptr, nullptr, CloseStream);
+}
+
+#else  // glibc
+
+ssize_t ReadStream(void* cookie, char* buffer, size_t size) {
+  return static_cast<CompressedStream*>(cookie)->Read(buffer, size);
+}
+
+ssize_t WriteStream(void* cookie, const char* buffer, size_t size) {
+  return static_cast<CompressedStream*>(cookie)->Write(buffer, size);
+}
+
+int CloseStream(void* cookie) {
+  return static_cast<CompressedStream*>(cookie)->Close();
+}
+
+FILE* WrapStream(CompressedStream* stream, bool write) {
+  cookie_io_functions_t functions = {};
+  functions.close = CloseStream;
+  if (write) {
+    functions.write = WriteStream;
+  } else {
+    functions.read = ReadStream;
+  }
+  return fopencookie(stream, write ? "w" : "r", functions);
+}
+
+#endif  // defined(__APPLE__) || defined(__FreeBSD__)
+
+#endif  // _WIN32
+
+}  // namespace
+
+Compression CompressionFromFilename(absl::string_view filename) {
+  if (absl::EndsWith(filename, ".gz")) {
+    return Compression::kGzip;
+  }
+  if (absl::EndsWith(filename, ".zst")) {
+    return Compression::kZstd;
+  }
+  return Compression::kNone;
+}
+
+Compression DetectCompression(absl::string_view prefix) {
+  if (absl::StartsWith(prefix, kGzipMagic)) {
+    return Compression::kGzip;
+  }
+  if (absl::StartsWith(prefix, kZstdMagic)) {
+    return Compression::kZstd;
+  }
+  return Compression::kNone;
+}
+
+absl::Status Compress(absl::string_view input,
+                      const CompressionOptions& options, std::string* output) {
+  output->clear();
+  return AppendCompressed(input, options, output);
+}
+
+absl::Status Decompress(absl::string_view input, std::string* output) {
+  const Compression compression = DetectCompression(input);
+  if (compression == Compression::kNone) {
+    output->assign(input.data(), input.size());
+    return absl::OkStatus();
+  }
+  std::unique_ptr<Decoder> decoder = Decoder::Create(compression);
+  output->clear();
+  size_t produced = 0, available = 0;
+  do {
+    const size_t input_size = input.size();
+    // Text compresses about 4:1, so that is the first guess.
+    const size_t old_size = output->size();
+    available = std::max<size_t>({input.size() * 4, old_size, 64 << 10});
+    output->resize(old_size + available);
+    absl::Status status =
+        decoder->Decode(&input, output->data() + old_size, available,
+                        &produced);
+    output->resize(old_size + produced);
+    RETURN_IF_ERROR(status);
+    if (produced == 0 && !input.empty() && input.size() == input_size) {
+      return absl::Status(absl::StatusCode::kDataLoss,
+                          "Trailing data after compressed data");
+    }
+  } while (!input.empty() || produced == available);
+  return decoder->Finish();
+}
+
+namespace compression_internal {
+
+FILE* OpenStream(absl::string_view filename, absl::string_view mode,
+                 const CompressionOptions& options) {
+#ifndef _WIN32
+  const bool read = absl::StartsWith(mode, "r");
+  const bool write = absl::StartsWith(mode, "w") || absl::StartsWith(mode, "a");
+  if ((!read && !write) || absl::StrContains(mode, "+")) {
+    errno = EINVAL;
+    return nullptr;
+  }
+  const std::string name(filename);
+  FILE* file =
+      fopen(name.c_str(), read ? "rb" : (mode[0] == 'w' ? "wb" : "ab"));
+  if (file == nullptr) {
+    return nullptr;
+  }
+  CompressedStream* stream;
+  if (read) {
+    std::string prefix(kZstdMagic.size(), '\0');
+    prefix.resize(fread(prefix.data(), 1, prefix.size(), file));
+    if (ferror(file)) {
+      const int error = errno;
+      fclose(file);
+      errno = error;
+      return nullptr;
+    }
+    stream = new CompressedStream(
+        file, Decoder::Create(DetectCompression(prefix)));
+    stream->set_read_buffer(std::move(prefix));
+  } else {
+    CompressionOptions stream_options = options;
+    stream_options.compression = CompressionFromFilename(filename);
+    if (stream_options.compression == Compression::kNone) {
+      return file;
+    }
+    stream = new CompressedStream(file, stream_options);
+  }
+  FILE* wrapped = WrapStream(stream, write);
+  if (wrapped == nullptr) {
+    const int error = errno;
+    stream->Close();
+    errno = error;
+  }
+  return wrapped;
+#else
+  errno = ENOSYS;
+  return nullptr;
+#endif  // _WIN32
+}
+
+}  // namespace compression_internal
+
+namespace {
+
+const internal::CompressionHooks kHooks = {
+    .open_stream =
+        [](absl::string_view filename, absl::string_view mode) {
+          return compression_internal::OpenStream(filename, mode,
+                                                  CompressionOptions());
+        },
+    .compresses =
+        [](absl::string_view filename) {
+          return CompressionFromFilename(filename) != Compression::kNone;
+        },
+    .compress =
+        [](absl::string_view filename, absl::string_view input,
+           std::string* output) {
+          CompressionOptions options;
+          options.compression = CompressionFromFilename(filename);
+          return Compress(input, options, output);
+        },
+    .decompress = Decompress,
+};
+
+// Runs when the "compression" target is linked in, which is alwayslink.
+const bool hooks_registered = [] {
+  internal::RegisterCompressionHooks(&kHooks);
+  return true;
+}();
+
+}  // namespace
+}  // namespace gxl
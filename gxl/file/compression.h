@@ -0,0 +1,90 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// gzip and zstd compression of whole buffers and of files.
+//
+// Compressed data is written as a sequence of independently compressed
+// blocks: gzip members or zstd frames, which the standard tools read as one
+// stream. The blocks are compressed in parallel, and reading needs no
+// knowledge of them.
+//
+// Files are usually handled through the file::kCompression option of
+// gxl::Open(), GetContents(), SetContents() and the proto helpers, which
+// uses the functions below. The option only works in binaries that depend on
+// this target, so that the others need not link zlib and zstd.
+
+#ifndef GXL_FILE_COMPRESSION_H_
+#define GXL_FILE_COMPRESSION_H_
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+
+namespace gxl {
+
+enum class Compression {
+  kNone,
+  kGzip,
+  kZstd,
+};
+
+// Returns the compression for files named "*.gz" or "*.zst", kNone for
+// others.
+Compression CompressionFromFilename(absl::string_view filename);
+
+// Returns the compression of data starting with "prefix", from its magic
+// bytes, or kNone. "prefix" needs at most 4 bytes.
+Compression DetectCompression(absl::string_view prefix);
+
+struct CompressionOptions {
+  Compression compression = Compression::kZstd;
+
+  // Codec-specific level; 0 means the codec's default.
+  int level = 0;
+
+  // The input is cut into blocks of this many bytes, which are compressed
+  // independently. Larger blocks compress slightly better; smaller ones
+  // spread over more threads.
+  size_t block_size = 1 << 20;
+
+  // Number of blocks compressed at once. 0 means one per CPU.
+  int num_threads = 0;
+};
+
+// Replaces "*output" with "input" compressed as per "options". kNone copies
+// the input.
+absl::Status Compress(absl::string_view input,
+                      const CompressionOptions& options, std::string* output);
+
+// Replaces "*output" with the decompression of "input", whose compression is
+// detected from its magic bytes. Data that is not compressed is copied as is.
+// Returns kDataLoss for corrupted or truncated data.
+absl::Status Decompress(absl::string_view input, std::string* output);
+
+namespace compression_internal {
+// Not part of the public API.
+
+// Opens "filename" as a stdio stream of its decompressed contents for mode
+// "r", or compressing what is written for modes "w" and "a", as
+// CompressionFromFilename() says; "a" appends new blocks. A 'b' in "mode" is
+// ignored. Sets errno and returns nullptr on failure.
+FILE* OpenStream(absl::string_view filename, absl::string_view mode,
+                 const CompressionOptions& options);
+
+}  // namespace compression_internal
+}  // namespace gxl
+
+#endif  // GXL_FILE_COMPRESSION_H_
@@ -0,0 +1,156 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gxl/file/compression.h"
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "gtest/gtest.h"
+#include "gxl/file/file.h"
+
+namespace gxl {
+namespace {
+
+std::string TestFile(absl::string_view name) {
+  return absl::StrCat(testing::TempDir(), "/", name);
+}
+
+std::string TestText() {
+  std::string text;
+  for (int i = 0; i < 20000; ++i) {
+    absl::StrAppend(&text, "line ", i, "\n");
+  }
+  return text;
+}
+
+// Reads "file" to the end and closes it.
+std::string ReadAll(File* file) {
+  std::string contents;
+  char buffer[1000];
+  for (size_t n; (n = file->Read(buffer, sizeof(buffer))) > 0;) {
+    contents.append(buffer, n);
+  }
+  EXPECT_TRUE(file->Close(file::Defaults()).ok());
+  return contents;
+}
+
+TEST(CompressionTest, CompressedContents) {
+  const std::string text = TestText();
+  for (const char* const extension : {".gz", ".zst"}) {
+    const std::string filename =
+        TestFile(absl::StrCat("compressed", extension));
+    ASSERT_TRUE(
+        SetContents(filename, text, file::Defaults() | file::kCompression)
+            .ok());
+    std::string raw;
+    ASSERT_TRUE(GetContents(filename, &raw, file::Defaults()).ok());
+    EXPECT_NE(DetectCompression(raw), Compression::kNone);
+    EXPECT_LT(raw.size(), text.size());
+
+    std::string contents;
+    ASSERT_TRUE(
+        GetContents(filename, &contents, file::Defaults() | file::kCompression)
+            .ok());
+    EXPECT_EQ(contents, text);
+
+    File* file = File::OpenCompressed(filename, "r");
+    ASSERT_NE(file, nullptr);
+    EXPECT_EQ(ReadAll(file), text);
+  }
+}
+
+TEST(CompressionTest, UncompressedContents) {
+  const std::string filename = TestFile("uncompressed.txt");
+  ASSERT_TRUE(
+      SetContents(filename, "plain", file::Defaults() | file::kCompression)
+          .ok());
+  std::string contents;
+  ASSERT_TRUE(GetContents(filename, &contents, file::Defaults()).ok());
+  EXPECT_EQ(contents, "plain");
+  ASSERT_TRUE(
+      GetContents(filename, &contents, file::Defaults() | file::kCompression)
+          .ok());
+  EXPECT_EQ(contents, "plain");
+}
+
+TEST(CompressionTest, MultipleBlocks) {
+  // Several blocks, compressed in parallel, decompress as one stream.
+  const std::string text = TestText();
+  for (const Compression compression :
+       {Compression::kGzip, Compression::kZstd}) {
+    std::string compressed;
+    ASSERT_TRUE(Compress(text,
+                         {.compression = compression,
+                          .block_size = 4096,
+                          .num_threads = 4},
+                         &compressed)
+                    .ok());
+    std::string contents;
+    ASSERT_TRUE(Decompress(compressed, &contents).ok());
+    EXPECT_EQ(contents, text);
+  }
+}
+
+TEST(CompressionTest, TruncatedData) {
+  std::string compressed;
+  ASSERT_TRUE(
+      Compress(TestText(), {.compression = Compression::kGzip}, &compressed)
+          .ok());
+  std::string contents;
+  EXPECT_EQ(Decompress(compressed.substr(0, compressed.size() / 2), &contents)
+                .code(),
+            absl::StatusCode::kDataLoss);
+}
+
+TEST(CompressionTest, StreamFlushesSeveralTimes) {
+  // A stream flushes several times, each time a few blocks.
+  const std::string text = TestText();
+  const std::string filename = TestFile("compressed_stream.zst");
+  FILE* stream = compression_internal::OpenStream(
+      filename, "w", {.block_size = 1000, .num_threads = 3});
+  ASSERT_NE(stream, nullptr);
+  for (size_t i = 0; i < text.size(); i += 777) {
+    const absl::string_view piece = absl::string_view(text).substr(i, 777);
+    ASSERT_EQ(fwrite(piece.data(), 1, piece.size(), stream), piece.size());
+  }
+  ASSERT_EQ(fclose(stream), 0);
+  std::string compressed;
+  ASSERT_TRUE(GetContents(filename, &compressed, file::Defaults()).ok());
+  std::string contents;
+  ASSERT_TRUE(Decompress(compressed, &contents).ok());
+  EXPECT_EQ(contents, text);
+}
+
+TEST(CompressionTest, AppendAddsBlocks) {
+  const std::string filename = TestFile("compressed_append.gz");
+  File* file = File::OpenCompressed(filename, "w");
+  ASSERT_NE(file, nullptr);
+  ASSERT_EQ(file->WriteString("first\n"), 6);
+  ASSERT_TRUE(file->Close(file::Defaults()).ok());
+  file = File::OpenCompressed(filename, "a");
+  ASSERT_NE(file, nullptr);
+  ASSERT_EQ(file->WriteString("second\n"), 7);
+  ASSERT_TRUE(file->Close(file::Defaults()).ok());
+
+  file = File::OpenCompressed(filename, "r");
+  ASSERT_NE(file, nullptr);
+  EXPECT_EQ(ReadAll(file), "first\nsecond\n");
+}
+
+}  // namespace
+}  // namespace gxl
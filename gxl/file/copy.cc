@@ -0,0 +1,400 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gxl/file/copy.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif  // _WIN32
+#if defined(__linux__)
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#include <sys/sendfile.h>
+#endif  // __linux__
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/match.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/strings/strip.h"
+#include "absl/types/span.h"
+#include "gxl/file/file.h"
+#include "gxl/file/internal/thread_pool.h"
+#include "gxl/file/path.h"
+#include "gxl/file/tree_walker.h"
+#include "gxl/file/vfs.h"
+#include "gxl/status/status_macros.h"
+
+namespace gxl {
+namespace {
+
+bool IsVirtual(absl::string_view path) {
+  absl::string_view relative_path;
+  return GetFileSystem(path, &relative_path) != nullptr;
+}
+
+absl::Status CopyError(absl::string_view from, absl::string_view to) {
+  return absl::ErrnoToStatus(
+      errno, absl::StrCat("Could not copy '", from, "' to '", to, "'"));
+}
+
+// Copies through memory, for files of registered file systems.
+absl::Status CopyContents(absl::string_view from, absl::string_view to,
+                          const CopyOptions& options) {
+  if (!options.overwrite && Exists(to, file::Defaults()).ok()) {
+    return absl::Status(absl::StatusCode::kAlreadyExists,
+                        absl::StrCat("Could not copy '", from, "' to '", to,
+                                     "': the target exists"));
+  }
+  std::string contents;
+  RETURN_IF_ERROR(GetContents(from, &contents, file::Defaults()));
+  return SetContents(to, contents, file::Defaults());
+}
+
+#ifndef _WIN32
+
+// Closes a file descriptor on destruction.
+class ScopedFd {
+ public:
+  explicit ScopedFd(int fd) : fd_(fd) {}
+  ScopedFd(const ScopedFd&) = delete;
+  ScopedFd& operator=(const ScopedFd&) = delete;
+  ~ScopedFd() {
+    if (fd_ >= 0) {
+      close(fd_);
+    }
+  }
+
+  int get() const { return fd_; }
+
+  // Returns false and sets errno if close() fails.
+  bool Close() {
+    const int fd = std::exchange(fd_, -1);
+    return close(fd) == 0;
+  }
+
+ private:
+  int fd_;
+};
+
+// Copies "size" bytes from "in" to "out", both at offset 0. Returns false and
+// sets errno on failure.
+bool CopyData(int in, int out, off_t size) {
+#if defined(__linux__)
+  if (ioctl(out, FICLONE, in) == 0) {
+    return true;
+  }
+  // copy_file_range() fails with EXDEV across file systems before Linux 5.3
+  // and on some file systems, and with ENOSYS before Linux 4.5. Both it and
+  // sendfile() fail before copying anything in those cases, so falling back
+  // is safe.
+  off_t copied = 0;
+  bool use_copy_file_range = true;
+  while (copied < size) {
+    const size_t chunk = std::min<off_t>(size - copied, 1 << 30);
+    ssize_t n = -1;
+    if (use_copy_file_range) {
+      n = copy_file_range(in, nullptr, out, nullptr, chunk, 0);
+      if (n < 0 && copied == 0 &&
+          (errno == EXDEV || errno == ENOSYS || errno == EOPNOTSUPP ||
+           errno == EINVAL)) {
+        use_copy_file_range = false;
+        continue;
+      }
+    } else {
+      n = sendfile(out, in, nullptr, chunk);
+      if (n < 0 && copied == 0 && (errno == EINVAL || errno == ENOSYS)) {
+        break;  // Falls back to read() and write().
+      }
+    }
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    if (n == 0) {
+      return true;  // The file shrank.
+    }
+    copied += n;
+  }
+  if (copied > 0) {
+    return true;
+  }
+#endif  // __linux__
+  char buffer[128 << 10];
+  while (true) {
+    const ssize_t n = read(in, buffer, sizeof(buffer));
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    if (n == 0) {
+      return true;
+    }
+    for (ssize_t written = 0; written < n;) {
+      const ssize_t m = write(out, buffer + written, n - written);
+      if (m < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return false;
+      }
+      written += m;
+    }
+  }
+}
+
+absl::Status CopyLocal(absl::string_view from, absl::string_view to,
+                       const CopyOptions& options) {
+  ScopedFd in(open(std::string(from).c_str(), O_RDONLY | O_CLOEXEC));
+  if (in.get() < 0) {
+    return CopyError(from, to);
+  }
+  struct stat in_stat;
+  if (fstat(in.get(), &in_stat) != 0) {
+    return CopyError(from, to);
+  }
+  if (S_ISDIR(in_stat.st_mode)) {
+    errno = EISDIR;
+    return CopyError(from, to);
+  }
+  // Truncated only once known not to be "from", under another name or
+  // through a hard link.
+  const int flags =
+      O_WRONLY | O_CREAT | O_CLOEXEC | (options.overwrite ? 0 : O_EXCL);
+  ScopedFd out(open(std::string(to).c_str(), flags,
+                    options.preserve_permissions ? in_stat.st_mode & 07777
+                                                 : 0666));
+  if (out.get() < 0) {
+    return CopyError(from, to);
+  }
+  struct stat out_stat;
+  if (fstat(out.get(), &out_stat) != 0) {
+    return CopyError(from, to);
+  }
+  if (out_stat.st_dev == in_stat.st_dev && out_stat.st_ino == in_stat.st_ino) {
+    return absl::Status(
+        absl::StatusCode::kInvalidArgument,
+        absl::StrCat("Could not copy '", from, "' to '", to,
+                     "': they are the same file"));
+  }
+  if (ftruncate(out.get(), 0) != 0) {
+    return CopyError(from, to);
+  }
+  if (!CopyData(in.get(), out.get(), in_stat.st_size)) {
+    return CopyError(from, to);
+  }
+  // Also applies to an existing target, and overrides the umask.
+  if (options.preserve_permissions &&
+      fchmod(out.get(), in_stat.st_mode & 07777) != 0) {
+    return CopyError(from, to);
+  }
+  if (!out.Close()) {
+    return CopyError(from, to);
+  }
+  return absl::OkStatus();
+}
+
+absl::Status CopySymlink(absl::string_view from, absl::string_view to,
+                         const CopyOptions& options) {
+  std::string target(PATH_MAX, '\0');
+  const ssize_t size =
+      readlink(std::string(from).c_str(), target.data(), target.size());
+  if (size < 0) {
+    return CopyError(from, to);
+  }
+  target.resize(size);
+  const std::string link(to);
+  if (options.overwrite) {
+    unlink(link.c_str());
+  }
+  if (symlink(target.c_str(), link.c_str()) != 0) {
+    return CopyError(from, to);
+  }
+  return absl::OkStatus();
+}
+
+absl::Status CreateDirectory(absl::string_view from, absl::string_view to) {
+  if (mkdir(std::string(to).c_str(), 0777) != 0 && errno != EEXIST) {
+    return CopyError(from, to);
+  }
+  return absl::OkStatus();
+}
+
+absl::Status CopyPermissions(absl::string_view from, absl::string_view to) {
+  struct stat from_stat;
+  if (stat(std::string(from).c_str(), &from_stat) != 0 ||
+      chmod(std::string(to).c_str(), from_stat.st_mode & 07777) != 0) {
+    return CopyError(from, to);
+  }
+  return absl::OkStatus();
+}
+
+// Like rename(), but fails with EEXIST rather than replace "to", atomically.
+int RenameNoReplace(const char* from, const char* to) {
+#if defined(__linux__)
+  const int result = renameat2(AT_FDCWD, from, AT_FDCWD, to, RENAME_NOREPLACE);
+  if (result == 0 || (errno != EINVAL && errno != ENOSYS)) {
+    return result;
+  }
+  // The kernel or the file system does not support the flag.
+#endif  // __linux__
+  // link() does not replace "to" either, but fails for directories.
+  if (link(from, to) != 0) {
+    return -1;
+  }
+  if (unlink(from) != 0) {
+    const int saved_errno = errno;
+    unlink(to);
+    errno = saved_errno;
+    return -1;
+  }
+  return 0;
+}
+
+#endif  // _WIN32
+
+}  // namespace
+
+absl::Status Copy(absl::string_view from, absl::string_view to,
+                  const CopyOptions& options) {
+  if (IsVirtual(from) || IsVirtual(to)) {
+    return CopyContents(from, to, options);
+  }
+#ifndef _WIN32
+  return CopyLocal(from, to, options);
+#else
+  return CopyContents(from, to, options);
+#endif  // _WIN32
+}
+
+absl::Status Move(absl::string_view from, absl::string_view to,
+                  const CopyOptions& options) {
+  if (IsVirtual(from) || IsVirtual(to)) {
+    RETURN_IF_ERROR(CopyContents(from, to, options));
+    return Delete(from, file::Defaults());
+  }
+#ifndef _WIN32
+  const std::string from_path(from), to_path(to);
+  const int renamed =
+      options.overwrite ? rename(from_path.c_str(), to_path.c_str())
+                        : RenameNoReplace(from_path.c_str(), to_path.c_str());
+  if (renamed == 0) {
+    return absl::OkStatus();
+  }
+  if (errno == EEXIST && !options.overwrite) {
+    return absl::Status(absl::StatusCode::kAlreadyExists,
+                        absl::StrCat("Could not move '", from, "' to '", to,
+                                     "': the target exists"));
+  }
+  if (errno != EXDEV) {
+    return absl::ErrnoToStatus(
+        errno, absl::StrCat("Could not move '", from, "' to '", to, "'"));
+  }
+  struct stat from_stat;
+  if (lstat(from_path.c_str(), &from_stat) != 0) {
+    return absl::ErrnoToStatus(
+        errno, absl::StrCat("Could not move '", from, "' to '", to, "'"));
+  }
+  if (S_ISDIR(from_stat.st_mode)) {
+    return absl::Status(absl::StatusCode::kUnimplemented,
+                        absl::StrCat("Could not move '", from, "' to '", to,
+                                     "': directories cannot be moved across "
+                                     "file systems"));
+  }
+  CopyOptions copy_options = options;
+  copy_options.preserve_permissions = true;
+  RETURN_IF_ERROR(S_ISLNK(from_stat.st_mode)
+                      ? CopySymlink(from, to, copy_options)
+                      : CopyLocal(from, to, copy_options));
+  if (unlink(from_path.c_str()) != 0) {
+    return absl::ErrnoToStatus(
+        errno, absl::StrCat("Could not delete '", from, "' after copying"));
+  }
+  return absl::OkStatus();
+#else
+  return absl::Status(absl::StatusCode::kUnimplemented,
+                      absl::StrCat("Could not move '", from, "' to '", to,
+                                   "': not supported on this platform"));
+#endif  // _WIN32
+}
+
+absl::Status CopyTree(absl::string_view from, absl::string_view to,
+                      const CopyOptions& options) {
+#ifndef _WIN32
+  std::vector<DirEntry> directories, files;
+  RETURN_IF_ERROR(WalkDirectoryTree(
+      from, WalkOptions(), [&](absl::Span<DirEntry> batch) {
+        for (DirEntry& entry : batch) {
+          if (entry.type == DirEntry::Type::kDirectory) {
+            directories.push_back(std::move(entry));
+          } else if (entry.type == DirEntry::Type::kFile ||
+                     entry.type == DirEntry::Type::kSymlink) {
+            files.push_back(std::move(entry));
+          }
+        }
+        return absl::OkStatus();
+      }));
+
+  // Parents sort before their children.
+  std::sort(
+      directories.begin(), directories.end(),
+      [](const DirEntry& a, const DirEntry& b) { return a.path < b.path; });
+  RETURN_IF_ERROR(CreateDirectory(from, to));
+  for (const DirEntry& directory : directories) {
+    RETURN_IF_ERROR(CreateDirectory(
+        directory.path,
+        JoinPath(to, absl::StripPrefix(directory.path, from))));
+  }
+
+  // The files and links, several at a time.
+  RETURN_IF_ERROR(internal::ParallelFor(
+      files.size(), options.num_threads, [&](size_t i) {
+        const std::string file_to =
+            JoinPath(to, absl::StripPrefix(files[i].path, from));
+        if (files[i].type == DirEntry::Type::kSymlink) {
+          return CopySymlink(files[i].path, file_to, options);
+        }
+        return CopyLocal(files[i].path, file_to, options);
+      }));
+
+  // Last, and children first, in case a directory is not writable.
+  if (options.preserve_permissions) {
+    for (auto it = directories.rbegin(); it != directories.rend(); ++it) {
+      RETURN_IF_ERROR(CopyPermissions(
+          it->path, JoinPath(to, absl::StripPrefix(it->path, from))));
+    }
+    RETURN_IF_ERROR(CopyPermissions(from, to));
+  }
+  return absl::OkStatus();
+#else
+  return absl::Status(absl::StatusCode::kUnimplemented,
+                      absl::StrCat("Could not copy '", from, "' to '", to,
+                                   "': not supported on this platform"));
+#endif  // _WIN32
+}
+
+}  // namespace gxl
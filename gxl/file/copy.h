@@ -0,0 +1,64 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Copying and moving files and directory trees.
+//
+// Local files are copied by the kernel, without passing the data through
+// user space: as a reflink sharing the data blocks where the file system
+// supports it (Btrfs, XFS), else with copy_file_range(), else sendfile(), and
+// with read() and write() as a last resort. Files of a file system registered
+// in vfs.h are copied through GetContents() and SetContents().
+
+#ifndef GXL_FILE_COPY_H_
+#define GXL_FILE_COPY_H_
+
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+
+namespace gxl {
+
+struct CopyOptions {
+  // Gives the copies the permission bits of the originals, regardless of the
+  // umask. Otherwise new files and directories get the default ones.
+  bool preserve_permissions = false;
+
+  // Replaces existing files. Otherwise copying onto an existing file fails
+  // with kAlreadyExists.
+  bool overwrite = true;
+
+  // Number of files CopyTree() copies at once. 0 means one per CPU.
+  int num_threads = 0;
+};
+
+// Copies the file "from" to "to". Fails with kInvalidArgument, leaving the
+// file unchanged, if "to" is "from" under the same or another name.
+absl::Status Copy(absl::string_view from, absl::string_view to,
+                  const CopyOptions& options = CopyOptions());
+
+// Renames "from" to "to". A file on another file system is copied with its
+// permissions, then deleted; a directory on another file system fails with
+// kUnimplemented. Without "overwrite", an existing "to" fails with
+// kAlreadyExists, which is checked atomically with the rename.
+absl::Status Move(absl::string_view from, absl::string_view to,
+                  const CopyOptions& options = CopyOptions());
+
+// Copies the directory "from" and everything below it to "to", which is
+// created if needed. Files are copied several at a time, and symbolic links
+// are copied as links. Other special files are skipped. Stops at the first
+// error and returns it, leaving what was copied so far.
+absl::Status CopyTree(absl::string_view from, absl::string_view to,
+                      const CopyOptions& options = CopyOptions());
+
+}  // namespace gxl
+
+#endif  // GXL_FILE_COPY_H_
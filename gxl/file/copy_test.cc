@@ -0,0 +1,140 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gxl/file/copy.h"
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <string>
+
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "gtest/gtest.h"
+#include "gxl/file/file.h"
+#include "gxl/file/filesystem.h"
+#include "gxl/file/path.h"
+
+namespace gxl {
+namespace {
+
+std::string TestPath(absl::string_view name) {
+  return JoinPath(testing::TempDir(), "copy_test", name);
+}
+
+std::string Contents(absl::string_view filename) {
+  std::string contents;
+  EXPECT_TRUE(GetContents(filename, &contents, file::Defaults()).ok());
+  return contents;
+}
+
+int Permissions(absl::string_view path) {
+  struct stat buffer;
+  EXPECT_EQ(stat(std::string(path).c_str(), &buffer), 0) << path;
+  return buffer.st_mode & 07777;
+}
+
+TEST(CopyTest, CopiesFiles) {
+  ASSERT_TRUE(RecursivelyCreateDir(TestPath("")).ok());
+  const std::string from = TestPath("from");
+  const std::string to = TestPath("to");
+  std::string data(3 << 20, 'x');
+  for (size_t i = 0; i < data.size(); i += 4096) {
+    data[i] = 'a' + i % 26;
+  }
+  ASSERT_TRUE(SetContents(from, data, file::Defaults()).ok());
+  ASSERT_EQ(chmod(from.c_str(), 0640), 0);
+
+  ASSERT_TRUE(Copy(from, to).ok());
+  EXPECT_EQ(Contents(to), data);
+
+  ASSERT_TRUE(SetContents(from, "short", file::Defaults()).ok());
+  ASSERT_TRUE(Copy(from, to, {.preserve_permissions = true}).ok());
+  EXPECT_EQ(Contents(to), "short");
+  EXPECT_EQ(Permissions(to), 0640);
+
+  EXPECT_EQ(Copy(from, to, {.overwrite = false}).code(),
+            absl::StatusCode::kAlreadyExists);
+  EXPECT_EQ(Copy(TestPath("missing"), to).code(),
+            absl::StatusCode::kNotFound);
+}
+
+TEST(CopyTest, DoesNotCopyAFileOntoItself) {
+  ASSERT_TRUE(RecursivelyCreateDir(TestPath("")).ok());
+  const std::string from = TestPath("self");
+  const std::string link = TestPath("self_link");
+  ASSERT_TRUE(SetContents(from, "kept", file::Defaults()).ok());
+  unlink(link.c_str());
+  ASSERT_EQ(::link(from.c_str(), link.c_str()), 0);
+
+  EXPECT_EQ(Copy(from, from).code(), absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(Copy(from, link).code(), absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(Contents(from), "kept");
+}
+
+TEST(CopyTest, MovesFiles) {
+  ASSERT_TRUE(RecursivelyCreateDir(TestPath("")).ok());
+  const std::string from = TestPath("move_from");
+  const std::string to = TestPath("move_to");
+  ASSERT_TRUE(SetContents(from, "moved", file::Defaults()).ok());
+  ASSERT_TRUE(Move(from, to).ok());
+  EXPECT_EQ(Contents(to), "moved");
+  EXPECT_FALSE(Exists(from, file::Defaults()).ok());
+
+  ASSERT_TRUE(SetContents(from, "again", file::Defaults()).ok());
+  EXPECT_EQ(Move(from, to, {.overwrite = false}).code(),
+            absl::StatusCode::kAlreadyExists);
+  EXPECT_EQ(Contents(to), "moved");
+  EXPECT_EQ(Contents(from), "again");
+
+  ASSERT_TRUE(Delete(to, file::Defaults()).ok());
+  ASSERT_TRUE(Move(from, to, {.overwrite = false}).ok());
+  EXPECT_EQ(Contents(to), "again");
+  EXPECT_EQ(Move(from, to).code(), absl::StatusCode::kNotFound);
+
+  const std::string dir = TestPath("move_dir");
+  ASSERT_TRUE(RecursivelyCreateDir(JoinPath(dir, "sub")).ok());
+  ASSERT_TRUE(Move(dir, TestPath("move_dir_to"), {.overwrite = false}).ok());
+  EXPECT_TRUE(Exists(TestPath("move_dir_to/sub"), file::Defaults()).ok());
+}
+
+TEST(CopyTest, CopiesTrees) {
+  const std::string from = TestPath("tree");
+  const std::string to = TestPath("tree_copy");
+  ASSERT_TRUE(RecursivelyCreateDir(JoinPath(from, "a/b")).ok());
+  ASSERT_TRUE(RecursivelyCreateDir(JoinPath(from, "empty")).ok());
+  for (int i = 0; i < 20; ++i) {
+    ASSERT_TRUE(SetContents(JoinPath(from, "a/b", absl::StrCat("f", i)),
+                            absl::StrCat("file ", i), file::Defaults())
+                    .ok());
+  }
+  ASSERT_TRUE(SetContents(JoinPath(from, "top"), "top", file::Defaults()).ok());
+  ASSERT_EQ(symlink("a/b/f1", JoinPath(from, "link").c_str()), 0);
+  ASSERT_EQ(chmod(JoinPath(from, "a").c_str(), 0750), 0);
+
+  ASSERT_TRUE(CopyTree(from, to,
+                       {.preserve_permissions = true, .num_threads = 4})
+                  .ok());
+  for (int i = 0; i < 20; ++i) {
+    EXPECT_EQ(Contents(JoinPath(to, "a/b", absl::StrCat("f", i))),
+              absl::StrCat("file ", i));
+  }
+  EXPECT_EQ(Contents(JoinPath(to, "top")), "top");
+  EXPECT_EQ(Contents(JoinPath(to, "link")), "file 1");
+  EXPECT_TRUE(IsDirectory(JoinPath(to, "empty")).ok());
+  EXPECT_EQ(Permissions(JoinPath(to, "a")), 0750);
+}
+
+}  // namespace
+}  // namespace gxl
@@ -22,56 +22,202 @@
 #define access _access
 #define F_OK 0
 #else
+#include <fcntl.h>
+#include <sys/uio.h>
 #include <unistd.h>
 #endif
+#if defined(__linux__)
+#include <sys/sysmacros.h>
+#endif  // __linux__
 
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <climits>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>  // NOLINT
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/status/status.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/span.h"
 #include "google/protobuf/io/tokenizer.h"
 #include "google/protobuf/message.h"
 #include "google/protobuf/text_format.h"
+#include "gxl/file/internal/compression_hooks.h"
+#include "gxl/file/internal/thread_pool.h"
+#include "gxl/file/io_stats.h"
+#include "gxl/file/mapped_file.h"
+#include "gxl/file/path.h"
+#include "gxl/file/read_cache.h"
+#include "gxl/file/vfs.h"
+#include "gxl/status/status_macros.h"
 
 namespace gxl {
 
+// The in-memory stream of a file of a registered FileSystem.
+struct File::VirtualFile {
+  ~VirtualFile() { free(buffer); }
+
+  FileSystem* file_system = nullptr;
+  std::string path;  // Relative to the file system.
+  bool write = false;
+  // Owned by the stream until it is closed; see fmemopen(), open_memstream().
+  char* buffer = nullptr;
+  size_t size = 0;
+};
+
 File::File(FILE* descriptor, absl::string_view name)
     : f_(descriptor), name_(name) {}
 
+File::~File() = default;
+
 bool File::Delete(absl::string_view filename) {
+  absl::string_view path;
+  if (FileSystem* file_system = GetFileSystem(filename, &path)) {
+    return file_system->Delete(path).ok();
+  }
   std::string null_terminated_name = std::string(filename);
   return remove(null_terminated_name.c_str()) == 0;
 }
 
 bool File::Exists(absl::string_view filename) {
+  absl::string_view path;
+  if (FileSystem* file_system = GetFileSystem(filename, &path)) {
+    return file_system->Exists(path).ok();
+  }
   std::string null_terminated_name = std::string(filename);
   return access(null_terminated_name.c_str(), F_OK) == 0;
 }
 
-size_t File::Size() {
+namespace {
+
+// Stats the open descriptor "fd" if "path" is null, else "path". Returns
+// false and sets errno on failure.
+bool StatFdOrPath(int fd, const char* path, FileStat* result) {
+#if defined(__linux__) && defined(STATX_BASIC_STATS)
+  // Asks for the fields used only, which spares network file systems from
+  // fetching the others.
+  struct statx f_statx;
+  if (statx(path == nullptr ? fd : AT_FDCWD, path == nullptr ? "" : path,
+            path == nullptr ? AT_EMPTY_PATH : 0,
+            STATX_TYPE | STATX_MODE | STATX_INO | STATX_SIZE | STATX_MTIME,
+            &f_statx) != 0) {
+    return false;
+  }
+  result->size = f_statx.stx_size;
+  result->mtime_nanos = int64_t{f_statx.stx_mtime.tv_sec} * 1000000000 +
+                        f_statx.stx_mtime.tv_nsec;
+  result->inode = f_statx.stx_ino;
+  result->device = makedev(f_statx.stx_dev_major, f_statx.stx_dev_minor);
+  result->mode = f_statx.stx_mode;
+  result->block_size = f_statx.stx_blksize;
+  return true;
+#elif !defined(_MSC_VER)
   struct stat f_stat;
-  stat(name_.c_str(), &f_stat);
-  return f_stat.st_size;
+  if ((path == nullptr ? fstat(fd, &f_stat) : stat(path, &f_stat)) != 0) {
+    return false;
+  }
+#ifdef __APPLE__
+  const struct timespec& mtime = f_stat.st_mtimespec;
+#else
+  const struct timespec& mtime = f_stat.st_mtim;
+#endif  // __APPLE__
+  result->size = f_stat.st_size;
+  result->mtime_nanos = int64_t{mtime.tv_sec} * 1000000000 + mtime.tv_nsec;
+  result->inode = f_stat.st_ino;
+  result->device = f_stat.st_dev;
+  result->mode = f_stat.st_mode;
+  result->block_size = f_stat.st_blksize;
+  return true;
+#else
+  struct _stat64 f_stat;
+  if ((path == nullptr ? _fstat64(fd, &f_stat) : _stat64(path, &f_stat)) !=
+      0) {
+    return false;
+  }
+  result->size = f_stat.st_size;
+  result->mtime_nanos = int64_t{f_stat.st_mtime} * 1000000000;
+  result->inode = f_stat.st_ino;
+  result->device = f_stat.st_dev;
+  result->mode = f_stat.st_mode;
+  return true;
+#endif
+}
+
+absl::Status CompressionNotLinkedError(absl::string_view filename) {
+  return absl::Status(
+      absl::StatusCode::kUnimplemented,
+      absl::StrCat("Could not open '", filename,
+                   "' with file::kCompression: depend on "
+                   "//gxl/file:compression to link the codecs in"));
 }
 
-bool File::Flush() { return fflush(f_) == 0; }
+}  // namespace
+
+absl::StatusOr<FileStat> File::StatUncached() const {
+  FileStat result;
+  if (virtual_ != nullptr) {
+    fflush(f_);  // Updates the size of a written stream.
+    result.size = virtual_->size;
+    return result;
+  }
+  // Streams without a descriptor, such as compressed ones, fall back to the
+  // name.
+  const int fd = fileno(f_);
+  if (!StatFdOrPath(fd, fd < 0 ? name_.c_str() : nullptr, &result)) {
+    return absl::ErrnoToStatus(errno,
+                               absl::StrCat("Could not stat '", name_, "'"));
+  }
+  return result;
+}
+
+absl::StatusOr<FileStat> File::Stat() {
+  if (virtual_ != nullptr) {
+    return StatUncached();
+  }
+  if (!stat_.has_value()) {
+    ASSIGN_OR_RETURN(stat_, StatUncached());
+  }
+  return *stat_;
+}
+
+size_t File::Size() {
+  absl::StatusOr<FileStat> result = StatUncached();
+  return result.ok() ? result->size : 0;
+}
+
+absl::Status File::StoreVirtual() {
+  if (virtual_ == nullptr || !virtual_->write) {
+    return absl::OkStatus();
+  }
+  return virtual_->file_system->SetContents(
+      virtual_->path, absl::string_view(virtual_->buffer, virtual_->size));
+}
+
+bool File::Flush() {
+  io_stats_internal::IoTimer timer(IoOp::kFlush, name_);
+  stat_.reset();
+  return fflush(f_) == 0 && StoreVirtual().ok();
+}
 
 // Deletes "this" on closing.
 bool File::Close() {
+  io_stats_internal::IoTimer timer(IoOp::kClose, name_);
   bool ok = true;
   if (f_ == nullptr) {
     return ok;
   }
   if (fclose(f_) == 0) {
     f_ = nullptr;
+    ok = StoreVirtual().ok();
   } else {
     ok = false;
   }
@@ -81,12 +227,14 @@ bool File::Close() {
 
 // Deletes "this" on closing.
 absl::Status File::Close(int /*flags*/) {
+  io_stats_internal::IoTimer timer(IoOp::kClose, name_);
   absl::Status status;
   if (f_ == nullptr) {
     return status;
   }
   if (fclose(f_) == 0) {
     f_ = nullptr;
+    status.Update(StoreVirtual());
   } else {
     status.Update(
         absl::Status(absl::StatusCode::kInvalidArgument,
@@ -96,17 +244,29 @@ absl::Status File::Close(int /*flags*/) {
   return status;
 }
 
+bool File::HasError() const { return f_ != nullptr && ferror(f_) != 0; }
+
 void File::ReadOrDie(void* buf, size_t size) {
   CHECK_EQ(fread(buf, 1, size, f_), size);
 }
 
-size_t File::Read(void* buf, size_t size) { return fread(buf, 1, size, f_); }
+size_t File::Read(void* buf, size_t size) {
+  io_stats_internal::IoTimer timer(IoOp::kRead, name_);
+  const size_t n = fread(buf, 1, size, f_);
+  timer.set_bytes(n);
+  return n;
+}
 
 void File::WriteOrDie(const void* buf, size_t size) {
+  stat_.reset();
   CHECK_EQ(fwrite(buf, 1, size, f_), size);
 }
 size_t File::Write(const void* buf, size_t size) {
-  return fwrite(buf, 1, size, f_);
+  io_stats_internal::IoTimer timer(IoOp::kWrite, name_);
+  stat_.reset();
+  const size_t n = fwrite(buf, 1, size, f_);
+  timer.set_bytes(n);
+  return n;
 }
 
 File* File::OpenOrDie(absl::string_view filename, absl::string_view mode) {
@@ -116,6 +276,11 @@ File* File::OpenOrDie(absl::string_view filename, absl::string_view mode) {
 }
 
 File* File::Open(absl::string_view filename, absl::string_view mode) {
+  io_stats_internal::IoTimer timer(IoOp::kOpen, filename);
+  absl::string_view path;
+  if (FileSystem* file_system = GetFileSystem(filename, &path)) {
+    return OpenVirtual(file_system, filename, path, mode);
+  }
   std::string null_terminated_name = std::string(filename);
   std::string null_terminated_mode = std::string(mode);
   FILE* f_des =
@@ -126,6 +291,81 @@ File* File::Open(absl::string_view filename, absl::string_view mode) {
   return f;
 }
 
+File* File::OpenCompressed(absl::string_view filename,
+                           absl::string_view mode) {
+  io_stats_internal::IoTimer timer(IoOp::kOpen, filename);
+  absl::string_view path;
+  if (GetFileSystem(filename, &path) != nullptr) {
+    errno = ENOTSUP;
+    return nullptr;
+  }
+  const internal::CompressionHooks* const hooks =
+      internal::GetCompressionHooks();
+  if (hooks == nullptr) {
+    errno = ENOTSUP;
+    return nullptr;
+  }
+  FILE* f_des = hooks->open_stream(filename, mode);
+  if (f_des == nullptr)
+    return nullptr;
+  return new File(f_des, filename);
+}
+
+#if !defined(_MSC_VER)
+File* File::OpenVirtual(FileSystem* file_system, absl::string_view filename,
+                        absl::string_view path, absl::string_view mode) {
+  std::string access_mode(mode);
+  access_mode.erase(std::remove(access_mode.begin(), access_mode.end(), 'b'),
+                    access_mode.end());
+  auto virtual_file = std::make_unique<VirtualFile>();
+  virtual_file->file_system = file_system;
+  virtual_file->path = std::string(path);
+  FILE* f_des = nullptr;
+  std::string contents;
+  if (access_mode == "r") {
+    if (!file_system->GetContents(path, &contents).ok()) {
+      return nullptr;
+    }
+    virtual_file->size = contents.size();
+    virtual_file->buffer =
+        static_cast<char*>(malloc(std::max<size_t>(contents.size(), 1)));
+    memcpy(virtual_file->buffer, contents.data(), contents.size());
+    f_des = fmemopen(virtual_file->buffer, virtual_file->size, "r");
+  } else if (access_mode == "w" || access_mode == "a") {
+    virtual_file->write = true;
+    if (access_mode == "w") {
+      // Like fopen(), create or truncate the file right away.
+      if (!file_system->SetContents(path, "").ok()) {
+        return nullptr;
+      }
+    } else if (file_system->Exists(path).ok() &&
+               !file_system->GetContents(path, &contents).ok()) {
+      return nullptr;
+    }
+    f_des = open_memstream(&virtual_file->buffer, &virtual_file->size);
+    if (f_des != nullptr &&
+        fwrite(contents.data(), 1, contents.size(), f_des) !=
+            contents.size()) {
+      fclose(f_des);
+      return nullptr;
+    }
+  }
+  if (f_des == nullptr) {
+    return nullptr;
+  }
+  File* f = new File(f_des, filename);
+  f->virtual_ = std::move(virtual_file);
+  return f;
+}
+#else
+File* File::OpenVirtual(FileSystem* /*file_system*/,
+                        absl::string_view /*filename*/,
+                        absl::string_view /*path*/,
+                        absl::string_view /*mode*/) {
+  return nullptr;
+}
+#endif  // !_MSC_VER
+
 char* File::ReadLine(char* output, uint64_t max_length) {
   return fgets(output, max_length, f_);
 }
@@ -165,6 +405,127 @@ bool File::WriteLine(absl::string_view line) {
   return Write("\n", 1) == 1;
 }
 
+#if !defined(_MSC_VER)
+namespace {
+
+// Like pread(), but retries on EINTR and short reads until "size" bytes are
+// read or end of file is reached.
+int64_t PReadFully(int fd, uint64_t offset, char* buf, size_t size) {
+  size_t done = 0;
+  while (done < size) {
+    const ssize_t n = pread(fd, buf + done, size - done, offset + done);
+    if (n < 0) {
+      if (errno == EINTR)
+        continue;
+      return -1;
+    }
+    if (n == 0)
+      break;
+    done += n;
+  }
+  return done;
+}
+
+}  // namespace
+
+int64_t File::PRead(uint64_t offset, void* buf, size_t size) const {
+  return PReadFully(fileno(f_), offset, static_cast<char*>(buf), size);
+}
+
+int64_t File::PWrite(uint64_t offset, const void* buf, size_t size) const {
+  stat_.reset();
+  const int fd = fileno(f_);
+  const char* data = static_cast<const char*>(buf);
+  size_t done = 0;
+  while (done < size) {
+    const ssize_t n = pwrite(fd, data + done, size - done, offset + done);
+    if (n < 0) {
+      if (errno == EINTR)
+        continue;
+      return -1;
+    }
+    done += n;
+  }
+  return done;
+}
+
+absl::Status File::PReadBatch(absl::Span<ReadRange> ranges) const {
+  std::vector<ReadRange*> sorted;
+  sorted.reserve(ranges.size());
+  for (ReadRange& range : ranges) {
+    range.bytes_read = 0;
+    sorted.push_back(&range);
+  }
+  std::sort(sorted.begin(), sorted.end(),
+            [](const ReadRange* a, const ReadRange* b) {
+              return a->offset < b->offset;
+            });
+
+  const int fd = fileno(f_);
+  std::vector<struct iovec> iov;
+  size_t i = 0;
+  while (i < sorted.size()) {
+    // Collect the run of ranges that are contiguous on disk.
+    size_t end = i;
+    uint64_t next_offset = sorted[i]->offset;
+    size_t total = 0;
+    iov.clear();
+    while (end < sorted.size() && sorted[end]->offset == next_offset &&
+           iov.size() < IOV_MAX) {
+      iov.push_back({sorted[end]->buff, sorted[end]->size});
+      next_offset += sorted[end]->size;
+      total += sorted[end]->size;
+      ++end;
+    }
+
+    ssize_t n;
+    do {
+      n = preadv(fd, iov.data(), iov.size(), sorted[i]->offset);
+    } while (n < 0 && errno == EINTR);
+    if (n < 0) {
+      return absl::ErrnoToStatus(
+          errno, absl::StrCat("Could not read from '", name_, "'"));
+    }
+
+    // Hand out the bytes, then finish any range left short by a partial read.
+    size_t remaining = n;
+    for (size_t j = i; j < end; ++j) {
+      ReadRange& range = *sorted[j];
+      range.bytes_read = std::min(range.size, remaining);
+      remaining -= range.bytes_read;
+      if (range.bytes_read < range.size && static_cast<size_t>(n) < total) {
+        const int64_t more = PReadFully(
+            fd, range.offset + range.bytes_read,
+            static_cast<char*>(range.buff) + range.bytes_read,
+            range.size - range.bytes_read);
+        if (more < 0) {
+          return absl::ErrnoToStatus(
+              errno, absl::StrCat("Could not read from '", name_, "'"));
+        }
+        range.bytes_read += more;
+      }
+    }
+    i = end;
+  }
+  return absl::OkStatus();
+}
+#else
+int64_t File::PRead(uint64_t /*offset*/, void* /*buf*/,
+                    size_t /*size*/) const {
+  return -1;
+}
+
+int64_t File::PWrite(uint64_t /*offset*/, const void* /*buf*/,
+                     size_t /*size*/) const {
+  return -1;
+}
+
+absl::Status File::PReadBatch(absl::Span<ReadRange> /*ranges*/) const {
+  return absl::Status(absl::StatusCode::kUnimplemented,
+                      "Positional reads are not supported on this platform");
+}
+#endif  // !_MSC_VER
+
 absl::string_view File::filename() const { return name_; }
 
 bool File::Open() const { return f_ != nullptr; }
@@ -173,8 +534,13 @@ void File::Init() {}
 
 absl::Status Open(absl::string_view filename, absl::string_view mode, File** f,
                   file::Options options) {
-  if (options == file::Defaults()) {
-    *f = File::Open(filename, mode);
+  if (file::IsDefaults(options)) {
+    if ((options & file::kCompression) &&
+        internal::GetCompressionHooks() == nullptr) {
+      return CompressionNotLinkedError(filename);
+    }
+    *f = (options & file::kCompression) ? File::OpenCompressed(filename, mode)
+                                        : File::Open(filename, mode);
     if (*f != nullptr) {
       return absl::OkStatus();
     }
@@ -186,14 +552,41 @@ absl::Status Open(absl::string_view filename, absl::string_view mode, File** f,
 File* OpenOrDie(absl::string_view filename, absl::string_view mode,
                 file::Options options) {
   File* f;
-  CHECK_EQ(options, file::Defaults());
+  CHECK(file::IsDefaults(options));
   f = File::Open(filename, mode);
   CHECK(f != nullptr) << absl::StrCat("Could not open '", filename, "'");
   return f;
 }
 
-absl::Status GetContents(absl::string_view filename, std::string* output,
-                         file::Options options) {
+namespace {
+
+// Whether to read "filename" through FileReadCache::Default(), which only
+// knows local files.
+bool UseReadCache(absl::string_view filename, file::Options options) {
+  absl::string_view path;
+  return file::IsDefaults(options) && (options & file::kReadCache) &&
+         GetFileSystem(filename, &path) == nullptr;
+}
+
+absl::Status GetContentsUntimed(absl::string_view filename,
+                                std::string* output, file::Options options) {
+  absl::string_view path;
+  if (FileSystem* file_system = GetFileSystem(filename, &path)) {
+    return file_system->GetContents(path, output);
+  }
+  if (UseReadCache(filename, options)) {
+    ASSIGN_OR_RETURN(const std::shared_ptr<const std::string> contents,
+                     FileReadCache::Default().GetContents(filename));
+    output->assign(*contents);
+    return absl::OkStatus();
+  }
+  if (file::IsDefaults(options) && (options & file::kMemoryMap)) {
+    ASSIGN_OR_RETURN(std::unique_ptr<MappedFile> mapped,
+                     MappedFile::Open(filename));
+    output->assign(mapped->data(), mapped->size());
+    return absl::OkStatus();
+  }
+
   File* file;
   auto status = Open(filename, "r", &file, options);
   if (!status.ok())
@@ -224,6 +617,32 @@ absl::Status GetContents(absl::string_view filename, std::string* output,
                       absl::StrCat("Could not read from '", filename, "'."));
 }
 
+}  // namespace
+
+absl::Status GetContents(absl::string_view filename, std::string* output,
+                         file::Options options) {
+  io_stats_internal::IoTimer timer(IoOp::kGetContents, filename);
+  if (file::IsDefaults(options) && (options & file::kCompression)) {
+    const internal::CompressionHooks* const hooks =
+        internal::GetCompressionHooks();
+    if (hooks == nullptr) {
+      return CompressionNotLinkedError(filename);
+    }
+    // Reads the file as is, then decompresses it in one pass.
+    std::string compressed;
+    absl::Status status = GetContentsUntimed(
+        filename, &compressed, options & ~file::kCompression);
+    if (status.ok()) {
+      status = hooks->decompress(compressed, output);
+    }
+    timer.set_bytes(status.ok() ? compressed.size() : 0);
+    return status;
+  }
+  absl::Status status = GetContentsUntimed(filename, output, options);
+  timer.set_bytes(status.ok() ? output->size() : 0);
+  return status;
+}
+
 absl::StatusOr<std::string> GetContents(absl::string_view path,
                                         file::Options options) {
   std::string contents;
@@ -236,7 +655,7 @@ absl::StatusOr<std::string> GetContents(absl::string_view path,
 
 absl::Status WriteString(File* file, absl::string_view contents,
                          file::Options options) {
-  if (options == file::Defaults() && file != nullptr &&
+  if (file::IsDefaults(options) && file != nullptr &&
       file->Write(contents.data(), contents.size()) == contents.size()) {
     return absl::OkStatus();
   }
@@ -245,8 +664,121 @@ absl::Status WriteString(File* file, absl::string_view contents,
       absl::StrCat("Could not write ", contents.size(), " bytes"));
 }
 
+namespace {
+
+#if !defined(_MSC_VER)
+absl::Status WriteFully(int fd, absl::string_view contents,
+                        absl::string_view filename) {
+  while (!contents.empty()) {
+    const ssize_t n = write(fd, contents.data(), contents.size());
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return absl::ErrnoToStatus(
+          errno, absl::StrCat("Could not write to '", filename, "'"));
+    }
+    contents.remove_prefix(n);
+  }
+  return absl::OkStatus();
+}
+
+absl::Status SyncDirectory(absl::string_view dirname) {
+  const std::string null_terminated_name(dirname.empty() ? "." : dirname);
+  const int fd =
+      open(null_terminated_name.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+  if (fd < 0) {
+    return absl::ErrnoToStatus(
+        errno, absl::StrCat("Could not open directory '", dirname, "'"));
+  }
+  absl::Status status;
+  if (fsync(fd) != 0) {
+    status = absl::ErrnoToStatus(
+        errno, absl::StrCat("Could not sync directory '", dirname, "'"));
+  }
+  close(fd);
+  return status;
+}
+
+// Writes "contents" to a new file next to "filename" and renames it over
+// "filename". The temporary file takes the permissions of the file it
+// replaces, if any.
+absl::Status AtomicSetContents(absl::string_view filename,
+                               absl::string_view contents, bool sync) {
+  static std::atomic<uint64_t> counter{0};
+  const std::string target(filename);
+  std::string temp;
+  int fd = -1;
+  for (int attempt = 0; fd < 0; ++attempt) {
+    temp = absl::StrCat(target, ".tmp.", getpid(), ".",
+                        counter.fetch_add(1, std::memory_order_relaxed));
+    fd = open(temp.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0666);
+    if (fd < 0 && (errno != EEXIST || attempt >= 100)) {
+      return absl::ErrnoToStatus(
+          errno, absl::StrCat("Could not create temporary file for '",
+                              filename, "'"));
+    }
+  }
+
+  struct stat f_stat;
+  if (stat(target.c_str(), &f_stat) == 0) {
+    fchmod(fd, f_stat.st_mode & 07777);
+  }
+  absl::Status status = WriteFully(fd, contents, temp);
+  if (status.ok() && sync && fsync(fd) != 0) {
+    status = absl::ErrnoToStatus(errno,
+                                 absl::StrCat("Could not sync '", temp, "'"));
+  }
+  if (close(fd) != 0 && status.ok()) {
+    status = absl::ErrnoToStatus(errno,
+                                 absl::StrCat("Could not close '", temp, "'"));
+  }
+  if (status.ok() && rename(temp.c_str(), target.c_str()) != 0) {
+    status = absl::ErrnoToStatus(
+        errno, absl::StrCat("Could not rename '", temp, "' to '", filename,
+                            "'"));
+  }
+  if (!status.ok()) {
+    unlink(temp.c_str());
+    return status;
+  }
+  // Make the rename itself durable.
+  return sync ? SyncDirectory(Dirname(filename)) : absl::OkStatus();
+}
+#else   // _MSC_VER
+absl::Status AtomicSetContents(absl::string_view filename,
+                               absl::string_view /*contents*/, bool /*sync*/) {
+  return absl::Status(
+      absl::StatusCode::kUnimplemented,
+      absl::StrCat("Could not write '", filename,
+                   "': atomic writes are not supported on this platform"));
+}
+#endif  // _MSC_VER
+
+}  // namespace
+
 absl::Status SetContents(absl::string_view filename, absl::string_view contents,
                          file::Options options) {
+  if (file::IsDefaults(options) && (options & file::kCompression)) {
+    const internal::CompressionHooks* const hooks =
+        internal::GetCompressionHooks();
+    if (hooks == nullptr) {
+      return CompressionNotLinkedError(filename);
+    }
+    if (hooks->compresses(filename)) {
+      std::string compressed;
+      RETURN_IF_ERROR(hooks->compress(filename, contents, &compressed));
+      return SetContents(filename, compressed, options & ~file::kCompression);
+    }
+  }
+  absl::string_view path;
+  if (FileSystem* file_system = GetFileSystem(filename, &path)) {
+    return file_system->SetContents(path, contents);
+  }
+  if (file::IsDefaults(options) && (options & file::kAtomicWrite)) {
+    return AtomicSetContents(filename, contents, !(options & file::kNoSync));
+  }
+
   File* file;
   auto status = Open(filename, "w", &file, options);
   if (!status.ok())
@@ -266,42 +798,110 @@ bool WriteStringToFile(absl::string_view data, absl::string_view file_name) {
 
 namespace {
 
-class NoOpErrorCollector : public google::protobuf::io::ErrorCollector {
+// Keeps the text parser's diagnostics, so they can be reported if the binary
+// parse fails too without parsing the text again.
+class CollectingErrorCollector : public google::protobuf::io::ErrorCollector {
  public:
-  ~NoOpErrorCollector() override = default;
-  void RecordError(int /*line*/, int /*column*/,
-                   absl::string_view /*message*/) override {}
+  ~CollectingErrorCollector() override = default;
+  void RecordError(int line, int column, absl::string_view message) override {
+    absl::StrAppend(&errors_, "\n", line + 1, ":", column + 1, ": ", message);
+  }
+
+  const std::string& errors() const { return errors_; }
+
+ private:
+  std::string errors_;
 };
 
+bool IsTextExtension(absl::string_view extension) {
+  return extension == "textproto" || extension == "txtpb" ||
+         extension == "pbtxt" || extension == "prototxt" ||
+         extension == "asciipb" || extension == "txt";
+}
+
+bool IsBinaryExtension(absl::string_view extension) {
+  return extension == "binpb" || extension == "pb" ||
+         extension == "binarypb" || extension == "bin";
+}
+
+}  // namespace
+
+ProtoFormat GuessProtoFormat(absl::string_view file_name,
+                             absl::string_view contents) {
+  const absl::string_view extension = Extension(file_name);
+  if (IsTextExtension(extension)) {
+    return ProtoFormat::kText;
+  }
+  if (IsBinaryExtension(extension)) {
+    return ProtoFormat::kBinary;
+  }
+  // Binary protos start with a tag and usually a small length or varint,
+  // which are control characters. Text protos have none besides whitespace.
+  for (const char c : contents.substr(0, 256)) {
+    const unsigned char u = c;
+    if ((u < 0x20 && u != '\t' && u != '\n' && u != '\v' && u != '\f' &&
+         u != '\r') ||
+        u == 0x7f) {
+      return ProtoFormat::kBinary;
+    }
+  }
+  return ProtoFormat::kText;
+}
+
+namespace {
+
+// Parses "str", the contents of "file_name", as ReadFileToProto() does.
+bool ParseProto(absl::string_view file_name, const std::string& str,
+                google::protobuf::Message* proto, ProtoFormat format) {
+  const bool try_both = format == ProtoFormat::kAuto;
+  if (try_both) {
+    format = GuessProtoFormat(file_name, str);
+  }
+  // Errors are only reported once every attempt has failed: a valid binary
+  // proto is not a valid text proto, and a failed text parse of it is not
+  // worth printing.
+  CollectingErrorCollector error_collector;
+  bool tried_text = false;
+  const auto parse_text = [&] {
+    tried_text = true;
+    google::protobuf::TextFormat::Parser parser;
+    parser.RecordErrorsTo(&error_collector);
+    return parser.ParseFromString(str, proto);
+  };
+  if (format == ProtoFormat::kText) {
+    if (parse_text() || (try_both && proto->ParseFromString(str))) {
+      return true;
+    }
+  } else {
+    if (proto->ParseFromString(str) || (try_both && parse_text())) {
+      return true;
+    }
+  }
+  if (tried_text) {
+    LOG(INFO) << "Could not parse contents of " << file_name << " as "
+              << proto->GetTypeName() << ":" << error_collector.errors();
+  } else {
+    LOG(INFO) << "Could not parse contents of " << file_name << " as binary "
+              << proto->GetTypeName();
+  }
+  return false;
+}
+
 }  // namespace
 
 bool ReadFileToProto(absl::string_view file_name,
                      google::protobuf::Message* proto) {
+  return ReadFileToProto(file_name, proto, ProtoFormat::kAuto);
+}
+
+bool ReadFileToProto(absl::string_view file_name,
+                     google::protobuf::Message* proto, ProtoFormat format) {
   std::string str;
   if (!ReadFileToString(file_name, &str)) {
     LOG(INFO) << "Could not read " << file_name;
     return false;
   }
-  // Attempt to decode ASCII before deciding binary. Do it in this order because
-  // it is much harder for a binary encoding to happen to be a valid ASCII
-  // encoding than the other way around. For instance "index: 1\n" is a valid
-  // (but nonsensical) binary encoding. We want to avoid printing errors for
-  // valid binary encodings if the ASCII parsing fails, and so specify a no-op
-  // error collector.
-  NoOpErrorCollector error_collector;
-  google::protobuf::TextFormat::Parser parser;
-  parser.RecordErrorsTo(&error_collector);
-  if (parser.ParseFromString(str, proto)) {
-    return true;
-  }
-  if (proto->ParseFromString(str)) {
-    return true;
-  }
-  // Re-parse the ASCII, just to show the diagnostics (we could also get them
-  // out of the ErrorCollector but this way is easier).
-  google::protobuf::TextFormat::ParseFromString(str, proto);
-  LOG(INFO) << "Could not parse contents of " << file_name;
-  return false;
+  return ParseProto(file_name, str, proto, format);
 }
 
 void ReadFileToProtoOrDie(absl::string_view file_name,
@@ -336,7 +936,20 @@ void WriteProtoToFileOrDie(const google::protobuf::Message& proto,
 absl::Status GetTextProto(absl::string_view filename,
                           google::protobuf::Message* proto,
                           file::Options options) {
-  if (options == file::Defaults()) {
+  if (file::IsDefaults(options) && (options & file::kCompression)) {
+    std::string str;
+    if (GetContents(filename, &str, options).ok() &&
+        ParseProto(filename, str, proto, ProtoFormat::kAuto)) {
+      return absl::OkStatus();
+    }
+  } else if (UseReadCache(filename, options)) {
+    absl::StatusOr<std::shared_ptr<const std::string>> contents =
+        FileReadCache::Default().GetContents(filename);
+    if (contents.ok() &&
+        ParseProto(filename, **contents, proto, ProtoFormat::kAuto)) {
+      return absl::OkStatus();
+    }
+  } else if (file::IsDefaults(options)) {
     if (ReadFileToProto(filename, proto))
       return absl::OkStatus();
   }
@@ -348,9 +961,10 @@ absl::Status GetTextProto(absl::string_view filename,
 absl::Status SetTextProto(absl::string_view filename,
                           const google::protobuf::Message& proto,
                           file::Options options) {
-  if (options == file::Defaults()) {
-    if (WriteProtoToASCIIFile(proto, filename))
-      return absl::OkStatus();
+  std::string proto_string;
+  if (file::IsDefaults(options) &&
+      google::protobuf::TextFormat::PrintToString(proto, &proto_string)) {
+    return SetContents(filename, proto_string, options);
   }
   return absl::Status(
       absl::StatusCode::kInvalidArgument,
@@ -360,8 +974,52 @@ absl::Status SetTextProto(absl::string_view filename,
 absl::Status GetBinaryProto(const absl::string_view filename,
                             google::protobuf::Message* proto,
                             file::Options options) {
+  absl::string_view path;
+  if (file::IsDefaults(options) && (options & file::kCompression)) {
+    std::string str;
+    if (GetContents(filename, &str, options).ok() &&
+        proto->ParseFromString(str)) {
+      return absl::OkStatus();
+    }
+    return absl::Status(
+        absl::StatusCode::kInvalidArgument,
+        absl::StrCat("Could not read proto from '", filename, "'."));
+  }
+  if (file::IsDefaults(options) && (options & file::kMemoryMap) &&
+      GetFileSystem(filename, &path) == nullptr) {
+    // Parse straight from the mapping, without copying into a string.
+    absl::StatusOr<std::unique_ptr<MappedFile>> mapped =
+        MappedFile::Open(filename);
+    if (!mapped.ok()) {
+      return mapped.status();
+    }
+    // ParseFromArray() takes an int size, which would wrap for larger files.
+    if ((*mapped)->size() > INT_MAX) {
+      return absl::Status(
+          absl::StatusCode::kOutOfRange,
+          absl::StrCat("Could not read proto from '", filename,
+                       "': the file is larger than 2 GiB."));
+    }
+    if (proto->ParseFromArray((*mapped)->data(),
+                              static_cast<int>((*mapped)->size()))) {
+      return absl::OkStatus();
+    }
+    return absl::Status(
+        absl::StatusCode::kInvalidArgument,
+        absl::StrCat("Could not read proto from '", filename, "'."));
+  }
+  if (UseReadCache(filename, options)) {
+    absl::StatusOr<std::shared_ptr<const std::string>> contents =
+        FileReadCache::Default().GetContents(filename);
+    if (contents.ok() && proto->ParseFromString(**contents)) {
+      return absl::OkStatus();
+    }
+    return absl::Status(
+        absl::StatusCode::kInvalidArgument,
+        absl::StrCat("Could not read proto from '", filename, "'."));
+  }
   std::string str;
-  if (options == file::Defaults() && ReadFileToString(filename, &str) &&
+  if (file::IsDefaults(options) && ReadFileToString(filename, &str) &&
       proto->ParseFromString(str)) {
     return absl::OkStatus();
   }
@@ -373,17 +1031,41 @@ absl::Status GetBinaryProto(const absl::string_view filename,
 absl::Status SetBinaryProto(absl::string_view filename,
                             const google::protobuf::Message& proto,
                             file::Options options) {
-  if (options == file::Defaults()) {
-    if (WriteProtoToFile(proto, filename))
-      return absl::OkStatus();
+  std::string proto_string;
+  if (file::IsDefaults(options) && proto.AppendToString(&proto_string)) {
+    return SetContents(filename, proto_string, options);
   }
   return absl::Status(
       absl::StatusCode::kInvalidArgument,
       absl::StrCat("Could not write proto to '", filename, "'."));
 }
 
+namespace file_internal {
+
+std::unique_ptr<google::protobuf::Arena> NewArenaForFile(
+    absl::string_view filename, double expansion) {
+  // Past this, the arena's usual block growth wastes little.
+  constexpr double kMaxStartBlockSize = 1 << 30;
+  const std::string null_terminated_name(filename);
+  struct stat f_stat;
+  google::protobuf::ArenaOptions options;
+  if (stat(null_terminated_name.c_str(), &f_stat) == 0) {
+    const size_t size = static_cast<size_t>(std::min(
+        static_cast<double>(f_stat.st_size) * expansion, kMaxStartBlockSize));
+    options.start_block_size = std::max(options.start_block_size, size);
+    options.max_block_size = std::max(options.max_block_size, size);
+  }
+  return std::make_unique<google::protobuf::Arena>(options);
+}
+
+}  // namespace file_internal
+
 absl::Status Delete(absl::string_view path, file::Options options) {
-  if (options == file::Defaults()) {
+  absl::string_view relative_path;
+  if (FileSystem* file_system = GetFileSystem(path, &relative_path)) {
+    return file_system->Delete(relative_path);
+  }
+  if (file::IsDefaults(options)) {
     std::string null_terminated_path = std::string(path);
     if (remove(null_terminated_path.c_str()) == 0)
       return absl::OkStatus();
@@ -393,7 +1075,11 @@ absl::Status Delete(absl::string_view path, file::Options options) {
 }
 
 absl::Status Exists(absl::string_view path, file::Options options) {
-  if (options == file::Defaults()) {
+  absl::string_view relative_path;
+  if (FileSystem* file_system = GetFileSystem(path, &relative_path)) {
+    return file_system->Exists(relative_path);
+  }
+  if (file::IsDefaults(options)) {
     std::string null_terminated_path = std::string(path);
     if (access(null_terminated_path.c_str(), F_OK) == 0) {
       return absl::OkStatus();
@@ -403,4 +1089,27 @@ absl::Status Exists(absl::string_view path, file::Options options) {
                       absl::StrCat("File '", path, "' does not exist."));
 }
 
+std::vector<absl::StatusOr<FileStat>> StatMany(
+    absl::Span<const std::string> paths, int num_threads) {
+  std::vector<absl::StatusOr<FileStat>> results(paths.size());
+  // Errors go to "results", so that every path is stat'ed.
+  internal::ParallelFor(paths.size(), num_threads, [&](size_t i) {
+    absl::string_view relative_path;
+    FileStat result;
+    if (GetFileSystem(paths[i], &relative_path) != nullptr) {
+      results[i] = absl::Status(
+          absl::StatusCode::kUnimplemented,
+          absl::StrCat("Could not stat '", paths[i],
+                       "': not supported by its file system"));
+    } else if (!StatFdOrPath(-1, paths[i].c_str(), &result)) {
+      results[i] = absl::ErrnoToStatus(
+          errno, absl::StrCat("Could not stat '", paths[i], "'"));
+    } else {
+      results[i] = result;
+    }
+    return absl::OkStatus();
+  }).IgnoreError();
+  return results;
+}
+
 }  // namespace gxl
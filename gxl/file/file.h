@@ -17,16 +17,34 @@
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
+#include <memory>
+#include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+#include "google/protobuf/arena.h"
 #include "google/protobuf/message.h"
 #include "gxl/status/status_macros.h"
 
 namespace gxl {
 
+class FileSystem;
+
+// Metadata of a file.
+struct FileStat {
+  uint64_t size = 0;
+  int64_t mtime_nanos = 0;  // Since the Unix epoch.
+  uint64_t inode = 0;
+  uint64_t device = 0;
+  uint32_t mode = 0;       // File type and permission bits, as st_mode.
+  int64_t block_size = 0;  // Preferred I/O size.
+};
+
 // This file defines some IO interfaces for compatibility with Google
 // IO specifications.
 class File {
@@ -36,6 +54,10 @@ class File {
   // Flags are defined by fopen(), that is "r", "r+", "w", "w+". "a", and "a+".
   // The caller should free the File after closing it by passing the returned
   // pointer to delete.
+  //
+  // Files of a file system registered in vfs.h are read into memory on
+  // opening and, when written, stored back on Flush() and Close(). They
+  // support "r", "w" and "a" only, and no positional reads or writes.
   static File* Open(absl::string_view filename, absl::string_view mode);
 
   // Opens file "name" with flags specified by "mode".
@@ -43,11 +65,27 @@ class File {
   // The caller should free the File after closing it by passing the returned
   // pointer to delete.
   static File* OpenOrDie(absl::string_view filename, absl::string_view mode);
+
+  // Like Open(), for a local file that may be compressed with gzip or zstd.
+  // With "r", reads return the decompressed contents if the file starts with
+  // the magic bytes of either format, and the raw contents otherwise. With
+  // "w" and "a", what is written is compressed if "filename" ends in ".gz" or
+  // ".zst", in blocks compressed in parallel; see compression.h. Size() is
+  // the size on disk, and positional reads and writes are not supported.
+  // Fails with ENOTSUP unless the binary depends on //gxl/file:compression.
+  static File* OpenCompressed(absl::string_view filename,
+                              absl::string_view mode);
 #endif  // SWIG
 
+  ~File();
+
   // Reads "size" bytes to buff from file, buff should be pre-allocated.
+  // Returns fewer bytes at end of file or on error; see HasError().
   size_t Read(void* buff, size_t size);
 
+  // Returns true if a Read() or Write() failed, like ferror() on the stream.
+  bool HasError() const;
+
   // Reads "size" bytes to buff from file, buff should be pre-allocated.
   // If read failed, program will exit.
   void ReadOrDie(void* buff, size_t size);
@@ -70,6 +108,32 @@ class File {
   // Writes a string to file.
   size_t WriteString(absl::string_view str);
 
+  // Positional reads and writes on the underlying file descriptor. They
+  // neither use nor move the stream position and take no locks, so several
+  // threads may issue them concurrently on the same File. They bypass the
+  // stdio buffer: Flush() pending Write()s before reading the same region.
+
+  // Reads up to "size" bytes at "offset" into buff. Returns the number of
+  // bytes read, which is less than "size" only at end of file, or -1 on error.
+  int64_t PRead(uint64_t offset, void* buff, size_t size) const;
+
+  // Writes "size" bytes of buff at "offset". Returns the number of bytes
+  // written, which is "size" unless an error occurred, or -1 on error.
+  int64_t PWrite(uint64_t offset, const void* buff, size_t size) const;
+
+  // A region of the file to be read by PReadBatch().
+  struct ReadRange {
+    uint64_t offset = 0;
+    size_t size = 0;
+    void* buff = nullptr;   // Must hold at least "size" bytes.
+    size_t bytes_read = 0;  // Output. Less than "size" only at end of file.
+  };
+
+  // Reads every range in "ranges". Ranges are issued in offset order and
+  // adjacent ranges are coalesced into a single vectored read. Returns the
+  // first error encountered; ranges past end of file are not an error.
+  absl::Status PReadBatch(absl::Span<ReadRange> ranges) const;
+
   // Writes a string to file and append a "\n".
   bool WriteLine(absl::string_view line);
 
@@ -80,7 +144,14 @@ class File {
   // Flushes buffer.
   bool Flush();
 
-  // Returns file size.
+  // Returns the metadata of the open file. It comes from the descriptor, not
+  // the name, so it describes this file even if it was renamed or replaced.
+  // The result is cached until the next write or Flush() through this File.
+  // For files of a registered file system, only the size is set.
+  absl::StatusOr<FileStat> Stat();
+
+  // Returns the current file size, or 0 if it fails. Unlike Stat(), it is
+  // not cached, so that it follows a file that another writer is growing.
   size_t Size();
 
   // Inits internal data structures.
@@ -98,10 +169,23 @@ class File {
   bool Open() const;
 
  private:
+  struct VirtualFile;
+
   File(FILE* descriptor, absl::string_view name);
 
+  static File* OpenVirtual(FileSystem* file_system, absl::string_view filename,
+                           absl::string_view path, absl::string_view mode);
+
+  // Stores the contents written to a virtual file.
+  absl::Status StoreVirtual();
+
+  // Stat() without the cache.
+  absl::StatusOr<FileStat> StatUncached() const;
+
   FILE* f_;
   std::string name_;
+  std::unique_ptr<VirtualFile> virtual_;  // Null for local files.
+  mutable std::optional<FileStat> stat_;  // Cached by Stat().
 };
 
 namespace file {
@@ -110,9 +194,48 @@ using Options = int;
 
 inline Options Defaults() { return 0xBABA; }
 
+// Optional behaviors, OR-ed into file::Defaults(). Functions that do not
+// support a given bit ignore it.
+
+// Reads the file through a read-only memory mapping instead of stdio, which
+// avoids the intermediate read buffer. Used by GetContents() and
+// GetBinaryProto(). See gxl::MappedFile for zero-copy access.
+inline constexpr Options kMemoryMap = 0x10000;
+
+// Writes to a temporary file next to the target and renames it into place,
+// so readers see either the old or the new contents, never a partial file.
+// The data and the rename are flushed to disk before returning unless
+// kNoSync is also set. Used by SetContents(), SetTextProto() and
+// SetBinaryProto().
+inline constexpr Options kAtomicWrite = 0x20000;
+
+// With kAtomicWrite, skips the fsync() calls: the replacement is still atomic
+// for readers, but may be lost on a crash.
+inline constexpr Options kNoSync = 0x40000;
+
+// Serves the contents from the process-wide FileReadCache, which rereads the
+// file only if it changed since it was cached. Used by GetContents(),
+// GetTextProto() and GetBinaryProto(). See read_cache.h.
+inline constexpr Options kReadCache = 0x80000;
+
+// Decompresses gzip and zstd files, detected by their magic bytes, on reading,
+// and compresses files named "*.gz" or "*.zst" on writing. Used by Open(),
+// which then uses File::OpenCompressed(), GetContents(), SetContents() and the
+// proto functions. The codecs are in the //gxl/file:compression target, which
+// the binary must depend on; otherwise these fail with kUnimplemented. See
+// compression.h.
+inline constexpr Options kCompression = 0x100000;
+
+// Returns true if "options" is file::Defaults(), possibly combined with the
+// optional behavior bits above.
+inline bool IsDefaults(Options options) {
+  return (options & 0xFFFF) == Defaults();
+}
+
 }  // namespace file
 
-// As of 2016-01, these methods can only be used with flags = file::Defaults().
+// As of 2016-01, these methods can only be used with flags = file::Defaults(),
+// optionally combined with the bits declared in namespace file above.
 
 // The caller should free the File after closing it by passing *f to delete.
 absl::Status Open(absl::string_view filename, absl::string_view mode, File** f,
@@ -147,6 +270,96 @@ absl::StatusOr<T> GetBinaryProto(absl::string_view filename,
 absl::Status SetBinaryProto(absl::string_view filename,
                             const google::protobuf::Message& proto,
                             file::Options options);
+
+// A message allocated on a google::protobuf::Arena, returned by the arena
+// overloads of GetBinaryProto() and GetTextProto(). If those created the
+// arena, the handle owns it and destroying the handle frees the message and
+// all of its submessages at once. Otherwise the message lives as long as the
+// caller's arena.
+template <typename T>
+class ArenaProto {
+ public:
+  ArenaProto(ArenaProto&&) = default;
+  ArenaProto& operator=(ArenaProto&&) = default;
+
+  T* get() const { return message_; }
+  T& operator*() const { return *message_; }
+  T* operator->() const { return message_; }
+
+  google::protobuf::Arena* arena() const { return arena_; }
+
+ private:
+  template <typename U>
+  friend absl::StatusOr<ArenaProto<U>> GetBinaryProto(
+      absl::string_view filename, google::protobuf::Arena* arena,
+      file::Options options);
+  template <typename U>
+  friend absl::StatusOr<ArenaProto<U>> GetTextProto(
+      absl::string_view filename, google::protobuf::Arena* arena,
+      file::Options options);
+
+  ArenaProto(std::unique_ptr<google::protobuf::Arena> owned_arena,
+             google::protobuf::Arena* arena, T* message)
+      : owned_arena_(std::move(owned_arena)),
+        arena_(arena),
+        message_(message) {}
+
+  std::unique_ptr<google::protobuf::Arena> owned_arena_;
+  google::protobuf::Arena* arena_;
+  T* message_;
+};
+
+namespace file_internal {
+
+// Returns a new arena whose first block is sized for a message parsed from
+// "filename", assuming the message takes about "expansion" times the file
+// size in memory.
+std::unique_ptr<google::protobuf::Arena> NewArenaForFile(
+    absl::string_view filename, double expansion);
+
+}  // namespace file_internal
+
+// Parses "filename" into a T allocated on "arena". If "arena" is null, a new
+// arena is created with a first block sized from the file, so that large
+// messages are built with a handful of allocations and freed in one go. On
+// failure the message is left on a caller-provided arena until it is reset.
+//
+// Usage:
+//
+//   ASSIGN_OR_RETURN(ArenaProto<RoutingTable> table,
+//                    GetBinaryProto<RoutingTable>(filename, nullptr,
+//                                                 file::Defaults()));
+//   Lookup(*table, ...);
+template <typename T>
+absl::StatusOr<ArenaProto<T>> GetBinaryProto(absl::string_view filename,
+                                             google::protobuf::Arena* arena,
+                                             file::Options options) {
+  std::unique_ptr<google::protobuf::Arena> owned_arena;
+  if (arena == nullptr) {
+    // Submessages and repeated fields take more memory than their encoding.
+    owned_arena = file_internal::NewArenaForFile(filename, 2.0);
+    arena = owned_arena.get();
+  }
+  T* proto = google::protobuf::Arena::Create<T>(arena);
+  RETURN_IF_ERROR(GetBinaryProto(filename, proto, options));
+  return ArenaProto<T>(std::move(owned_arena), arena, proto);
+}
+
+// As above, for text protos.
+template <typename T>
+absl::StatusOr<ArenaProto<T>> GetTextProto(absl::string_view filename,
+                                           google::protobuf::Arena* arena,
+                                           file::Options options) {
+  std::unique_ptr<google::protobuf::Arena> owned_arena;
+  if (arena == nullptr) {
+    // Field names and number formatting make text larger than the message.
+    owned_arena = file_internal::NewArenaForFile(filename, 1.0);
+    arena = owned_arena.get();
+  }
+  T* proto = google::protobuf::Arena::Create<T>(arena);
+  RETURN_IF_ERROR(GetTextProto(filename, proto, options));
+  return ArenaProto<T>(std::move(owned_arena), arena, proto);
+}
 absl::Status SetContents(absl::string_view filename, absl::string_view contents,
                          file::Options options);
 absl::Status GetContents(absl::string_view filename, std::string* output,
@@ -158,8 +371,28 @@ absl::Status WriteString(File* file, absl::string_view contents,
 
 bool ReadFileToString(absl::string_view file_name, std::string* output);
 bool WriteStringToFile(absl::string_view data, absl::string_view file_name);
+
+// Serialization formats of a proto file.
+enum class ProtoFormat {
+  kAuto,  // Determined by GuessProtoFormat().
+  kText,
+  kBinary,
+};
+
+// Guesses whether a proto file is in text or binary format, without parsing
+// it. Well-known extensions such as ".textproto" or ".binpb" decide;
+// otherwise files whose first bytes contain control characters are taken to
+// be binary. Never returns kAuto.
+ProtoFormat GuessProtoFormat(absl::string_view file_name,
+                             absl::string_view contents);
+
+// Reads "file_name" in either format. The guessed format is parsed first and
+// the other one only if that fails.
 bool ReadFileToProto(absl::string_view file_name,
                      google::protobuf::Message* proto);
+// As above, but only tries "format" unless it is kAuto.
+bool ReadFileToProto(absl::string_view file_name,
+                     google::protobuf::Message* proto, ProtoFormat format);
 void ReadFileToProtoOrDie(absl::string_view file_name,
                           google::protobuf::Message* proto);
 bool WriteProtoToASCIIFile(const google::protobuf::Message& proto,
@@ -174,6 +407,12 @@ void WriteProtoToFileOrDie(const google::protobuf::Message& proto,
 absl::Status Delete(absl::string_view path, file::Options options);
 absl::Status Exists(absl::string_view path, file::Options options);
 
+// Returns the metadata of each of "paths", in order, issuing up to
+// "num_threads" stat calls at once; 0 means one per CPU. Symbolic links are
+// followed. Paths of registered file systems fail with kUnimplemented.
+std::vector<absl::StatusOr<FileStat>> StatMany(
+    absl::Span<const std::string> paths, int num_threads = 0);
+
 }  // namespace gxl
 
 #endif  // GXL_FILE_FILE_H_
@@ -0,0 +1,252 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gxl/file/file.h"
+
+#include <sys/stat.h>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "google/protobuf/descriptor.pb.h"
+#include "gtest/gtest.h"
+
+namespace gxl {
+namespace {
+
+std::string TestFile(absl::string_view name) {
+  return absl::StrCat(testing::TempDir(), "/", name);
+}
+
+TEST(FileTest, SetAndGetContents) {
+  const std::string filename = TestFile("set_and_get_contents");
+  ASSERT_TRUE(SetContents(filename, "hello\nworld\n", file::Defaults()).ok());
+  std::string contents;
+  ASSERT_TRUE(GetContents(filename, &contents, file::Defaults()).ok());
+  EXPECT_EQ(contents, "hello\nworld\n");
+}
+
+TEST(FileTest, SetContentsAtomic) {
+  const std::string filename = TestFile("set_contents_atomic");
+  ASSERT_TRUE(SetContents(filename, "old", file::Defaults()).ok());
+  ASSERT_TRUE(
+      SetContents(filename, "new", file::Defaults() | file::kAtomicWrite)
+          .ok());
+  std::string contents;
+  ASSERT_TRUE(GetContents(filename, &contents, file::Defaults()).ok());
+  EXPECT_EQ(contents, "new");
+
+  ASSERT_TRUE(SetContents(filename, "newer",
+                          file::Defaults() | file::kAtomicWrite |
+                              file::kNoSync)
+                  .ok());
+  ASSERT_TRUE(GetContents(filename, &contents, file::Defaults()).ok());
+  EXPECT_EQ(contents, "newer");
+
+  EXPECT_FALSE(SetContents(TestFile("no_such_dir/file"), "x",
+                           file::Defaults() | file::kAtomicWrite)
+                   .ok());
+}
+
+TEST(FileTest, GetContentsMemoryMapped) {
+  const std::string filename = TestFile("get_contents_memory_mapped");
+  const std::string expected(1 << 20, 'x');
+  ASSERT_TRUE(SetContents(filename, expected, file::Defaults()).ok());
+  std::string contents;
+  ASSERT_TRUE(
+      GetContents(filename, &contents, file::Defaults() | file::kMemoryMap)
+          .ok());
+  EXPECT_EQ(contents, expected);
+
+  EXPECT_FALSE(GetContents(TestFile("does_not_exist"), &contents,
+                           file::Defaults() | file::kMemoryMap)
+                   .ok());
+}
+
+TEST(FileTest, GetBinaryProtoMemoryMapped) {
+  const std::string filename = TestFile("get_binary_proto_memory_mapped");
+  google::protobuf::FileDescriptorProto proto;
+  proto.set_name("mapped.proto");
+  ASSERT_TRUE(SetBinaryProto(filename, proto, file::Defaults()).ok());
+  google::protobuf::FileDescriptorProto read;
+  ASSERT_TRUE(
+      GetBinaryProto(filename, &read, file::Defaults() | file::kMemoryMap)
+          .ok());
+  EXPECT_EQ(read.name(), "mapped.proto");
+
+  // Reports the error of opening the file.
+  EXPECT_EQ(GetBinaryProto(TestFile("does_not_exist"), &read,
+                           file::Defaults() | file::kMemoryMap)
+                .code(),
+            absl::StatusCode::kNotFound);
+}
+
+TEST(FileTest, StatAndStatMany) {
+  const std::string filename = TestFile("stat");
+  ASSERT_TRUE(SetContents(filename, "12345", file::Defaults()).ok());
+  File* file = File::Open(filename, "a");
+  ASSERT_NE(file, nullptr);
+  absl::StatusOr<FileStat> stat = file->Stat();
+  ASSERT_TRUE(stat.ok()) << stat.status();
+  EXPECT_EQ(stat->size, 5);
+  EXPECT_NE(stat->inode, 0);
+  EXPECT_GT(stat->mtime_nanos, 0);
+
+  // Describes the open file even after it is replaced.
+  ASSERT_TRUE(SetContents(TestFile("stat_other"), "1", file::Defaults()).ok());
+  ASSERT_EQ(rename(TestFile("stat_other").c_str(), filename.c_str()), 0);
+  EXPECT_EQ(file->Size(), 5);
+  ASSERT_EQ(file->WriteString("678"), 3);
+  ASSERT_TRUE(file->Flush());
+  EXPECT_EQ(file->Size(), 8);
+  EXPECT_EQ(file->PWrite(8, "9", 1), 1);
+  EXPECT_EQ(file->Stat()->size, 9);
+  ASSERT_TRUE(file->Close(file::Defaults()).ok());
+
+  // Size() follows a file that another writer grows.
+  File* reader = File::Open(filename, "r");
+  ASSERT_NE(reader, nullptr);
+  EXPECT_EQ(reader->Stat()->size, 1);
+  ASSERT_TRUE(SetContents(filename, "123", file::Defaults()).ok());
+  EXPECT_EQ(reader->Size(), 3);
+  ASSERT_TRUE(reader->Close(file::Defaults()).ok());
+
+  const std::vector<std::string> paths = {filename, TestFile("no_such_file"),
+                                          testing::TempDir()};
+  const std::vector<absl::StatusOr<FileStat>> stats = StatMany(paths, 2);
+  ASSERT_EQ(stats.size(), 3);
+  ASSERT_TRUE(stats[0].ok());
+  EXPECT_EQ(stats[0]->size, 3);
+  EXPECT_EQ(stats[1].status().code(), absl::StatusCode::kNotFound);
+  ASSERT_TRUE(stats[2].ok());
+  EXPECT_TRUE(S_ISDIR(stats[2]->mode));
+}
+
+TEST(FileTest, PReadAndPWrite) {
+  const std::string filename = TestFile("pread_pwrite");
+  File* file = File::Open(filename, "w+");
+  ASSERT_NE(file, nullptr);
+  EXPECT_EQ(file->PWrite(0, "0123456789", 10), 10);
+  EXPECT_EQ(file->PWrite(4, "ab", 2), 2);
+
+  char buf[16];
+  EXPECT_EQ(file->PRead(2, buf, 6), 6);
+  EXPECT_EQ(absl::string_view(buf, 6), "23ab67");
+  EXPECT_EQ(file->PRead(8, buf, sizeof(buf)), 2);
+  EXPECT_EQ(file->PRead(100, buf, sizeof(buf)), 0);
+  EXPECT_TRUE(file->Close(file::Defaults()).ok());
+}
+
+TEST(FileTest, PReadBatch) {
+  const std::string filename = TestFile("pread_batch");
+  ASSERT_TRUE(SetContents(filename, "abcdefghij", file::Defaults()).ok());
+  File* file = File::Open(filename, "r");
+  ASSERT_NE(file, nullptr);
+
+  char a[3], b[2], c[4], d[4];
+  File::ReadRange ranges[4];
+  ranges[0] = {.offset = 5, .size = sizeof(b), .buff = b};
+  ranges[1] = {.offset = 2, .size = sizeof(a), .buff = a};  // Adjacent to b.
+  ranges[2] = {.offset = 0, .size = sizeof(c), .buff = c};  // Overlaps a.
+  ranges[3] = {.offset = 8, .size = sizeof(d), .buff = d};  // Past the end.
+  ASSERT_TRUE(file->PReadBatch(absl::MakeSpan(ranges)).ok());
+  EXPECT_EQ(absl::string_view(a, ranges[1].bytes_read), "cde");
+  EXPECT_EQ(absl::string_view(b, ranges[0].bytes_read), "fg");
+  EXPECT_EQ(absl::string_view(c, ranges[2].bytes_read), "abcd");
+  EXPECT_EQ(absl::string_view(d, ranges[3].bytes_read), "ij");
+  EXPECT_TRUE(file->Close(file::Defaults()).ok());
+}
+
+TEST(FileTest, GuessProtoFormat) {
+  EXPECT_EQ(GuessProtoFormat("config.textproto", "\x0a\x01x"),
+            ProtoFormat::kText);
+  EXPECT_EQ(GuessProtoFormat("data.binpb", "name: \"x\""),
+            ProtoFormat::kBinary);
+  EXPECT_EQ(GuessProtoFormat("data", "name: \"x\"\n"), ProtoFormat::kText);
+  EXPECT_EQ(GuessProtoFormat("data", "\x0a\x01x"), ProtoFormat::kBinary);
+}
+
+TEST(FileTest, ReadFileToProto) {
+  google::protobuf::FileDescriptorProto expected;
+  expected.set_name("foo.proto");
+  expected.set_package("foo");
+
+  const std::string text_file = TestFile("read_file_to_proto_text");
+  ASSERT_TRUE(SetTextProto(text_file, expected, file::Defaults()).ok());
+  const std::string binary_file = TestFile("read_file_to_proto_binary");
+  ASSERT_TRUE(SetBinaryProto(binary_file, expected, file::Defaults()).ok());
+
+  for (const std::string& filename : {text_file, binary_file}) {
+    google::protobuf::FileDescriptorProto proto;
+    ASSERT_TRUE(ReadFileToProto(filename, &proto)) << filename;
+    EXPECT_EQ(proto.SerializeAsString(), expected.SerializeAsString());
+  }
+
+  google::protobuf::FileDescriptorProto proto;
+  EXPECT_TRUE(ReadFileToProto(text_file, &proto, ProtoFormat::kText));
+  EXPECT_FALSE(ReadFileToProto(binary_file, &proto, ProtoFormat::kText));
+  EXPECT_TRUE(ReadFileToProto(binary_file, &proto, ProtoFormat::kBinary));
+}
+
+TEST(FileTest, GetBinaryProtoOnArena) {
+  google::protobuf::FileDescriptorProto expected;
+  expected.set_name("foo.proto");
+  expected.add_message_type()->set_name("Foo");
+  const std::string filename = TestFile("get_binary_proto_on_arena");
+  ASSERT_TRUE(SetBinaryProto(filename, expected, file::Defaults()).ok());
+
+  absl::StatusOr<ArenaProto<google::protobuf::FileDescriptorProto>> owned =
+      GetBinaryProto<google::protobuf::FileDescriptorProto>(
+          filename, nullptr, file::Defaults());
+  ASSERT_TRUE(owned.ok()) << owned.status();
+  EXPECT_NE(owned->arena(), nullptr);
+  EXPECT_EQ((*owned)->SerializeAsString(), expected.SerializeAsString());
+
+  google::protobuf::Arena arena;
+  absl::StatusOr<ArenaProto<google::protobuf::FileDescriptorProto>> borrowed =
+      GetBinaryProto<google::protobuf::FileDescriptorProto>(
+          filename, &arena, file::Defaults());
+  ASSERT_TRUE(borrowed.ok()) << borrowed.status();
+  EXPECT_EQ(borrowed->arena(), &arena);
+  EXPECT_EQ((*borrowed)->SerializeAsString(), expected.SerializeAsString());
+
+  EXPECT_FALSE(GetTextProto<google::protobuf::FileDescriptorProto>(
+                   TestFile("does_not_exist"), nullptr, file::Defaults())
+                   .ok());
+}
+
+TEST(FileTest, CompressionNeedsTheCodecs) {
+  // This test does not link in //gxl/file:compression.
+  const std::string filename = TestFile("no_codecs.gz");
+  EXPECT_EQ(
+      SetContents(filename, "text", file::Defaults() | file::kCompression)
+          .code(),
+      absl::StatusCode::kUnimplemented);
+  std::string contents;
+  EXPECT_EQ(
+      GetContents(filename, &contents, file::Defaults() | file::kCompression)
+          .code(),
+      absl::StatusCode::kUnimplemented);
+  File* file = nullptr;
+  EXPECT_EQ(Open(filename, "r", &file, file::Defaults() | file::kCompression)
+                .code(),
+            absl::StatusCode::kUnimplemented);
+  EXPECT_EQ(File::OpenCompressed(filename, "r"), nullptr);
+}
+
+}  // namespace
+}  // namespace gxl
@@ -22,14 +22,24 @@
 // * Options are available to keep the trailing '\n' for each line, to remove
 //   carriage-return characters ('\r'), and to remove blank lines.
 //
+// When the lines do not need to outlive the loop iteration, FileLineViews
+// avoids copying every line into a std::string:
+//   for (absl::string_view line : FileLineViews("myfile.txt")) { ... }
+//
 #ifndef GXL_FILE_FILELINEITER_H_
 #define GXL_FILE_FILELINEITER_H_
 
 #include <algorithm>
+#include <cerrno>
 #include <cstdint>
+#include <cstring>
+#include <memory>
 #include <string>
 
 #include "absl/log/log.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
 #include "gxl/file/file.h"
 
 namespace gxl {
@@ -73,15 +83,15 @@ class FileLineIterator {
     if (file_ == nullptr)
       return;
     do {
+      // Start afresh after a skipped blank line, which is not empty when
+      // KEEP_LINEFEED is set.
+      line_.clear();
       while (true) {
-        int i = next_position_after_eol_;
-        for (; i < buffer_size_; ++i) {
-          if (buffer_[i] == '\n')
-            break;
-        }
-        if (i == buffer_size_) {
-          line_.append(&buffer_[next_position_after_eol_],
-                       i - next_position_after_eol_);
+        const char* const start = &buffer_[next_position_after_eol_];
+        const char* const eol = static_cast<const char*>(
+            memchr(start, '\n', buffer_size_ - next_position_after_eol_));
+        if (eol == nullptr) {
+          line_.append(start, buffer_size_ - next_position_after_eol_);
           buffer_size_ = file_->Read(&buffer_, kBufferSize);
           if (buffer_size_ < 0) {
             LOG(WARNING) << "Error while reading file.";
@@ -96,9 +106,8 @@ class FileLineIterator {
             break;
           }
         } else {
-          line_.append(&buffer_[next_position_after_eol_],
-                       i - next_position_after_eol_ + 1);
-          next_position_after_eol_ = i + 1;
+          line_.append(start, eol - start + 1);
+          next_position_after_eol_ = eol - buffer_ + 1;
           break;
         }
       }
@@ -108,12 +117,13 @@ class FileLineIterator {
   }
 
   void PostProcessLine() {
-    if (HasOption(REMOVE_INLINE_CR)) {
+    if (HasOption(REMOVE_INLINE_CR) &&
+        line_.find('\r') != std::string::npos) {
       line_.erase(std::remove(line_.begin(), line_.end(), '\r'), line_.end());
     }
-    const auto eol = std::find(line_.begin(), line_.end(), '\n');
-    if (!HasOption(KEEP_LINEFEED) && eol != line_.end()) {
-      line_.erase(eol);
+    // A line holds at most one '\n', as its last character.
+    if (!HasOption(KEEP_LINEFEED) && !line_.empty() && line_.back() == '\n') {
+      line_.pop_back();
     }
   }
 
@@ -185,6 +195,203 @@ class FileLines {
   const int options_;
 };
 
+class FileLineViews;
+
+// Input iterator over the lines of a FileLineViews. Each line is an
+// absl::string_view into the reader's buffer and is only valid until the
+// iterator is incremented.
+class FileLineViewIterator {
+ public:
+  absl::string_view operator*() const { return line_; }
+
+  bool operator!=(const FileLineViewIterator& other) const {
+    return lines_ != other.lines_;
+  }
+
+  bool operator==(const FileLineViewIterator& other) const {
+    return lines_ == other.lines_;
+  }
+
+  inline void operator++();
+
+ private:
+  friend class FileLineViews;
+
+  explicit FileLineViewIterator(FileLineViews* lines) : lines_(lines) {}
+
+  FileLineViews* lines_;
+  absl::string_view line_;
+};
+
+// Like FileLines, but yields absl::string_view lines that point into one
+// large reusable buffer. Lines are found with memchr() and only bytes of a
+// line that straddles a buffer refill are moved. A line longer than the
+// buffer grows it. The same FileLineIterator options apply.
+//
+// Usage:
+//
+//   for (absl::string_view line : FileLineViews(filename, file)) {
+//     ...
+//   }
+//
+// Only one pass is possible: begin() continues where the last iteration
+// stopped.
+class FileLineViews {
+ public:
+  static constexpr size_t kDefaultBufferSize = 1 << 20;
+
+  // Initializes with a provided file, taking ownership of it. If file is
+  // nullptr, this class behaves as if the file was empty.
+  FileLineViews(absl::string_view filename, File* const file,
+                const int options = FileLineIterator::DEFAULT,
+                size_t buffer_size = kDefaultBufferSize)
+      : filename_(filename),
+        file_(file),
+        options_(options),
+        capacity_(std::max<size_t>(buffer_size, 1)),
+        buffer_(new char[capacity_]) {}
+
+  // Initializes the FileLineViews ignoring errors, like the corresponding
+  // FileLines constructor.
+  explicit FileLineViews(absl::string_view filename,
+                         int options = FileLineIterator::DEFAULT,
+                         size_t buffer_size = kDefaultBufferSize)
+      : FileLineViews(
+            filename,
+            [&]() {
+              File* file = nullptr;
+              if (!Open(filename, "r", &file, file::Defaults()).ok()) {
+                LOG(WARNING) << "Could not open: " << filename;
+              }
+              return file;
+            }(),
+            options, buffer_size) {}
+
+  FileLineViews(const FileLineViews&) = delete;
+  FileLineViews& operator=(const FileLineViews&) = delete;
+
+  ~FileLineViews() {
+    if (file_ != nullptr)
+      file_->Close(file::Defaults()).IgnoreError();
+  }
+
+  FileLineViewIterator begin() {
+    FileLineViewIterator it(this);
+    ++it;
+    return it;
+  }
+
+  FileLineViewIterator end() { return FileLineViewIterator(nullptr); }
+
+  // Returns the read error that ended the iteration early, or OK if it
+  // reached the end of the file. Check it after the loop.
+  absl::Status status() const { return status_; }
+
+ private:
+  friend class FileLineViewIterator;
+
+  bool HasOption(int option) const { return options_ & option; }
+
+  // Stores the next line in "line". Returns false at end of file.
+  bool NextLine(absl::string_view* line) {
+    do {
+      if (!NextRawLine(line))
+        return false;
+      PostProcessLine(line);
+    } while (HasOption(FileLineIterator::REMOVE_BLANK_LINES) &&
+             (line->empty() || *line == "\n"));
+    return true;
+  }
+
+  // Stores the next line, including its '\n' if any, in "line".
+  bool NextRawLine(absl::string_view* line) {
+    size_t scan = begin_;
+    while (true) {
+      char* const eol =
+          static_cast<char*>(memchr(&buffer_[scan], '\n', end_ - scan));
+      if (eol != nullptr) {
+        const size_t next = eol - buffer_.get() + 1;
+        *line = absl::string_view(&buffer_[begin_], next - begin_);
+        begin_ = next;
+        return true;
+      }
+      scan = end_;
+      if (!Refill(&scan)) {
+        if (begin_ == end_)
+          return false;
+        *line = absl::string_view(&buffer_[begin_], end_ - begin_);
+        begin_ = end_;
+        return true;
+      }
+    }
+  }
+
+  // Makes room after the pending partial line and reads more data. "scan" is
+  // the position where the search for '\n' resumes and is adjusted if the
+  // partial line moves. Returns false at end of file or on error, which
+  // goes to status_.
+  bool Refill(size_t* scan) {
+    if (file_ == nullptr)
+      return false;
+    if (begin_ > 0) {
+      // Move the partial line to the front of the buffer.
+      memmove(&buffer_[0], &buffer_[begin_], end_ - begin_);
+      end_ -= begin_;
+      *scan -= begin_;
+      begin_ = 0;
+    } else if (end_ == capacity_) {
+      // The line does not fit: grow the buffer.
+      std::unique_ptr<char[]> bigger(new char[2 * capacity_]);
+      memcpy(bigger.get(), buffer_.get(), end_);
+      buffer_ = std::move(bigger);
+      capacity_ *= 2;
+    }
+    const size_t n = file_->Read(&buffer_[end_], capacity_ - end_);
+    if (n == 0) {
+      // A compressed stream fails with EIO on corrupt or truncated data.
+      if (file_->HasError()) {
+        status_ = absl::ErrnoToStatus(
+            errno, absl::StrCat("Could not read '", filename_, "'"));
+      }
+      file_->Close(file::Defaults()).IgnoreError();
+      file_ = nullptr;
+      return false;
+    }
+    end_ += n;
+    return true;
+  }
+
+  void PostProcessLine(absl::string_view* line) {
+    char* const data = &buffer_[line->data() - buffer_.get()];
+    size_t size = line->size();
+    if (HasOption(FileLineIterator::REMOVE_INLINE_CR) &&
+        memchr(data, '\r', size) != nullptr) {
+      size = std::remove(data, data + size, '\r') - data;
+    }
+    // A line holds at most one '\n', as its last character.
+    if (!HasOption(FileLineIterator::KEEP_LINEFEED) && size > 0 &&
+        data[size - 1] == '\n') {
+      --size;
+    }
+    *line = absl::string_view(data, size);
+  }
+
+  const std::string filename_;
+  File* file_;
+  const int options_;
+  absl::Status status_;
+  size_t capacity_;
+  std::unique_ptr<char[]> buffer_;
+  size_t begin_ = 0;  // Start of the unconsumed data.
+  size_t end_ = 0;    // End of the valid data.
+};
+
+inline void FileLineViewIterator::operator++() {
+  if (!lines_->NextLine(&line_)) {
+    lines_ = nullptr;
+  }
+}
+
 }  // namespace gxl
 
 #endif  // GXL_FILE_FILELINEITER_H_
@@ -0,0 +1,172 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gxl/file/filelineiter.h"
+
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "gtest/gtest.h"
+#include "gxl/file/file.h"
+
+namespace gxl {
+namespace {
+
+std::string TestFile(absl::string_view name) {
+  return absl::StrCat(testing::TempDir(), "/", name);
+}
+
+// Writes "contents" to a file and returns its name.
+std::string WriteTestFile(absl::string_view name, absl::string_view contents) {
+  const std::string filename = TestFile(name);
+  EXPECT_TRUE(SetContents(filename, contents, file::Defaults()).ok());
+  return filename;
+}
+
+std::vector<std::string> ReadLines(absl::string_view filename, int options) {
+  std::vector<std::string> lines;
+  for (const std::string& line : FileLines(filename, options)) {
+    lines.push_back(line);
+  }
+  return lines;
+}
+
+std::vector<std::string> ReadLineViews(absl::string_view filename, int options,
+                                       size_t buffer_size) {
+  std::vector<std::string> lines;
+  for (absl::string_view line :
+       FileLineViews(filename, options, buffer_size)) {
+    lines.push_back(std::string(line));
+  }
+  return lines;
+}
+
+// Checks that FileLines and FileLineViews, with a buffer smaller and larger
+// than the file, all produce "expected".
+void ExpectLines(absl::string_view filename, int options,
+                 const std::vector<std::string>& expected) {
+  EXPECT_EQ(ReadLines(filename, options), expected);
+  for (size_t buffer_size : {1, 3, 16, 1 << 20}) {
+    EXPECT_EQ(ReadLineViews(filename, options, buffer_size), expected)
+        << "buffer_size: " << buffer_size;
+  }
+}
+
+TEST(FileLinesTest, SplitsLines) {
+  const std::string filename = WriteTestFile("lines", "a\nbc\n\ndef\n");
+  ExpectLines(filename, FileLineIterator::DEFAULT, {"a", "bc", "", "def"});
+  ExpectLines(filename, FileLineIterator::KEEP_LINEFEED,
+              {"a\n", "bc\n", "\n", "def\n"});
+}
+
+TEST(FileLinesTest, LastLineWithoutLinefeed) {
+  const std::string filename = WriteTestFile("last_line", "a\nbc");
+  ExpectLines(filename, FileLineIterator::DEFAULT, {"a", "bc"});
+  ExpectLines(filename, FileLineIterator::KEEP_LINEFEED, {"a\n", "bc"});
+}
+
+TEST(FileLinesTest, EmptyAndMissingFiles) {
+  ExpectLines(WriteTestFile("empty", ""), FileLineIterator::DEFAULT, {});
+  ExpectLines(TestFile("missing"), FileLineIterator::DEFAULT, {});
+}
+
+TEST(FileLinesTest, LinesLongerThanBuffer) {
+  // Longer than the 5 KiB buffer of FileLineIterator, and than the buffer
+  // given to FileLineViews, which has to grow.
+  const std::string long_line(12345, 'x');
+  const std::string filename = WriteTestFile(
+      "long_lines", absl::StrCat("a\n", long_line, "\nb\n", long_line));
+  ExpectLines(filename, FileLineIterator::DEFAULT,
+              {"a", long_line, "b", long_line});
+  ExpectLines(filename, FileLineIterator::KEEP_LINEFEED,
+              {"a\n", long_line + "\n", "b\n", long_line});
+}
+
+TEST(FileLinesTest, Crlf) {
+  const std::string filename = WriteTestFile("crlf", "a\r\nb\rc\r\n\r\nd");
+  ExpectLines(filename, FileLineIterator::DEFAULT,
+              {"a\r", "b\rc\r", "\r", "d"});
+  ExpectLines(filename, FileLineIterator::REMOVE_INLINE_CR,
+              {"a", "bc", "", "d"});
+  ExpectLines(filename,
+              FileLineIterator::REMOVE_INLINE_CR |
+                  FileLineIterator::KEEP_LINEFEED,
+              {"a\n", "bc\n", "\n", "d"});
+  ExpectLines(filename,
+              FileLineIterator::REMOVE_INLINE_CR |
+                  FileLineIterator::REMOVE_BLANK_LINES,
+              {"a", "bc", "d"});
+  // Without REMOVE_INLINE_CR, "\r" is not a blank line.
+  ExpectLines(filename, FileLineIterator::REMOVE_BLANK_LINES,
+              {"a\r", "b\rc\r", "\r", "d"});
+}
+
+TEST(FileLinesTest, RemoveBlankLines) {
+  const std::string filename =
+      WriteTestFile("blank_lines", "\n\na\n\n\nb\n\n");
+  ExpectLines(filename, FileLineIterator::REMOVE_BLANK_LINES, {"a", "b"});
+  ExpectLines(filename,
+              FileLineIterator::REMOVE_BLANK_LINES |
+                  FileLineIterator::KEEP_LINEFEED,
+              {"a\n", "b\n"});
+}
+
+TEST(FileLineViewsTest, StatusAfterTheLastLine) {
+  const std::string filename = WriteTestFile("status_ok", "a\nb\n");
+  FileLineViews lines(filename);
+  int count = 0;
+  for (absl::string_view line : lines) {
+    EXPECT_FALSE(line.empty());
+    ++count;
+  }
+  EXPECT_EQ(count, 2);
+  EXPECT_TRUE(lines.status().ok()) << lines.status();
+}
+
+TEST(FileLineViewsTest, ReadErrorIsNotTheEnd) {
+  std::string text;
+  for (int i = 0; i < 10000; ++i) {
+    absl::StrAppend(&text, "line ", i, "\n");
+  }
+  const std::string filename = TestFile("truncated.gz");
+  ASSERT_TRUE(
+      SetContents(filename, text, file::Defaults() | file::kCompression).ok());
+  std::string compressed;
+  ASSERT_TRUE(GetContents(filename, &compressed, file::Defaults()).ok());
+  ASSERT_EQ(truncate(filename.c_str(), compressed.size() / 2), 0);
+
+  FileLineViews lines(filename, File::OpenCompressed(filename, "r"));
+  int count = 0;
+  for (absl::string_view line : lines) {
+    EXPECT_FALSE(line.empty());
+    ++count;
+  }
+  EXPECT_LT(count, 10000);
+  EXPECT_FALSE(lines.status().ok());
+}
+
+TEST(FileLinesTest, OnlyBlankLines) {
+  const std::string filename = WriteTestFile("only_blank_lines", "\n\n\n");
+  ExpectLines(filename, FileLineIterator::REMOVE_BLANK_LINES, {});
+  ExpectLines(filename,
+              FileLineIterator::REMOVE_BLANK_LINES |
+                  FileLineIterator::KEEP_LINEFEED,
+              {});
+}
+
+}  // namespace
+}  // namespace gxl
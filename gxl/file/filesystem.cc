@@ -81,8 +81,8 @@ class DirectoryListing {
  private:
   void ReadNextEntry() {
     next_entry_ = readdir(dir_);
-    while (next_entry_ && (std::string(next_entry_->d_name) == "." ||
-                           std::string(next_entry_->d_name) == "..")) {
+    while (next_entry_ && (strcmp(next_entry_->d_name, ".") == 0 ||
+                           strcmp(next_entry_->d_name, "..") == 0)) {
       next_entry_ = readdir(dir_);
     }
   }
@@ -243,6 +243,10 @@ int mkdir(std::string path) { return _mkdir(path.c_str()); }
 #endif
 
 absl::Status RecursivelyCreateDir(absl::string_view path) {
+  absl::string_view relative_path;
+  if (FileSystem* file_system = GetFileSystem(path, &relative_path)) {
+    return file_system->RecursivelyCreateDir(relative_path);
+  }
   if (path.empty() || Exists(path, file::Defaults()).ok()) {
     return absl::OkStatus();
   }
@@ -259,4 +263,53 @@ absl::Status RecursivelyCreateDir(absl::string_view path) {
   return absl::OkStatus();
 }
 
+namespace {
+
+class DiskFileSystem : public FileSystem {
+ public:
+  absl::Status GetContents(absl::string_view path,
+                           std::string* output) override {
+    absl::Status status = gxl::GetContents(path, output, file::Defaults());
+    struct stat buffer;
+    if (!status.ok() && stat(std::string(path).c_str(), &buffer) != 0) {
+      return absl::ErrnoToStatus(
+          errno, absl::StrCat("Could not read '", path, "'"));
+    }
+    return status;
+  }
+
+  absl::Status SetContents(absl::string_view path,
+                           absl::string_view contents) override {
+    return gxl::SetContents(path, contents, file::Defaults());
+  }
+
+  absl::Status Exists(absl::string_view path) override {
+    struct stat buffer;
+    if (stat(std::string(path).c_str(), &buffer) != 0) {
+      return absl::ErrnoToStatus(errno,
+                                 absl::StrCat("Could not stat '", path, "'"));
+    }
+    return absl::OkStatus();
+  }
+
+  absl::Status Delete(absl::string_view path) override {
+    if (remove(std::string(path).c_str()) != 0) {
+      return absl::ErrnoToStatus(
+          errno, absl::StrCat("Could not delete '", path, "'"));
+    }
+    return absl::OkStatus();
+  }
+
+  absl::Status RecursivelyCreateDir(absl::string_view path) override {
+    return gxl::RecursivelyCreateDir(path);
+  }
+};
+
+}  // namespace
+
+FileSystem* LocalFileSystem() {
+  static FileSystem* const file_system = new DiskFileSystem();
+  return file_system;
+}
+
 }  // namespace gxl
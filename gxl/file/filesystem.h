@@ -17,6 +17,7 @@
 
 #include "absl/status/status.h"
 #include "absl/strings/match.h"
+#include "gxl/file/vfs.h"
 
 namespace gxl {
 
@@ -35,6 +36,10 @@ absl::Status IsDirectory(absl::string_view file_name);
 
 absl::Status RecursivelyCreateDir(absl::string_view path);
 
+// Returns the local file system as a FileSystem, for instance to wrap it in a
+// CachingFileSystem. Never deleted.
+FileSystem* LocalFileSystem();
+
 }  // namespace gxl
 
 #endif  // GXL_FILE_FILESYSTEM_H_
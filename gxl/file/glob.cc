@@ -0,0 +1,427 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gxl/file/glob.h"
+
+#ifndef _WIN32
+#include <dirent.h>
+#include <sys/stat.h>
+#endif  // _WIN32
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/match.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/string_view.h"
+#include "gxl/file/path.h"
+#include "gxl/status/status_macros.h"
+
+namespace gxl {
+namespace {
+
+absl::Status InvalidPattern(absl::string_view pattern,
+                            absl::string_view reason) {
+  return absl::Status(
+      absl::StatusCode::kInvalidArgument,
+      absl::StrCat("Invalid glob pattern '", pattern, "': ", reason));
+}
+
+// Returns the index of the ']' closing the character class that starts at
+// "open", or npos.
+size_t ClassEnd(absl::string_view s, size_t open) {
+  size_t i = open + 1;
+  if (i < s.size() && (s[i] == '!' || s[i] == '^')) {
+    ++i;
+  }
+  if (i < s.size() && s[i] == ']') {  // A leading ']' is literal.
+    ++i;
+  }
+  for (; i < s.size(); ++i) {
+    if (s[i] == '\\') {
+      ++i;
+    } else if (s[i] == ']') {
+      return i;
+    }
+  }
+  return absl::string_view::npos;
+}
+
+// Expands the first top-level {...} group of "pattern", recursively, like the
+// shell does before matching.
+absl::Status ExpandBraces(absl::string_view pattern, absl::string_view whole,
+                          std::vector<std::string>* out) {
+  size_t open = absl::string_view::npos;
+  for (size_t i = 0; i < pattern.size(); ++i) {
+    if (pattern[i] == '\\') {
+      ++i;
+    } else if (pattern[i] == '[') {
+      const size_t end = ClassEnd(pattern, i);
+      if (end == absl::string_view::npos) {
+        return InvalidPattern(whole, "unterminated '['");
+      }
+      i = end;
+    } else if (pattern[i] == '{') {
+      open = i;
+      break;
+    }
+  }
+  if (open == absl::string_view::npos) {
+    out->emplace_back(pattern);
+    return absl::OkStatus();
+  }
+
+  std::vector<absl::string_view> alternatives;
+  int depth = 0;
+  size_t start = open + 1;
+  for (size_t i = open + 1; i < pattern.size(); ++i) {
+    const char c = pattern[i];
+    if (c == '\\') {
+      ++i;
+    } else if (c == '[') {
+      i = ClassEnd(pattern, i);
+      if (i == absl::string_view::npos) {
+        return InvalidPattern(whole, "unterminated '['");
+      }
+    } else if (c == '{') {
+      ++depth;
+    } else if (c == ',' && depth == 0) {
+      alternatives.push_back(pattern.substr(start, i - start));
+      start = i + 1;
+    } else if (c == '}' && depth-- == 0) {
+      alternatives.push_back(pattern.substr(start, i - start));
+      const absl::string_view prefix = pattern.substr(0, open);
+      const absl::string_view suffix = pattern.substr(i + 1);
+      for (absl::string_view alternative : alternatives) {
+        RETURN_IF_ERROR(ExpandBraces(
+            absl::StrCat(prefix, alternative, suffix), whole, out));
+      }
+      return absl::OkStatus();
+    }
+  }
+  return InvalidPattern(whole, "unterminated '{'");
+}
+
+bool IsHidden(absl::string_view name) {
+  return !name.empty() && name[0] == '.';
+}
+
+#ifndef _WIN32
+struct ListedEntry {
+  std::string name;
+  unsigned char type;
+};
+
+// Returns the entries of "dir" other than "." and "..". Directories that
+// cannot be read are treated as empty.
+std::vector<ListedEntry> ListDirectory(const std::string& dir) {
+  std::vector<ListedEntry> entries;
+  DIR* d = opendir(dir.empty() ? "." : dir.c_str());
+  if (d == nullptr) {
+    return entries;
+  }
+  while (const struct dirent* entry = readdir(d)) {
+    const char* name = entry->d_name;
+    if (name[0] == '.' &&
+        (name[1] == '\0' || (name[1] == '.' && name[2] == '\0'))) {
+      continue;
+    }
+    entries.push_back({name, entry->d_type});
+  }
+  closedir(d);
+  return entries;
+}
+
+bool IsDirectory(const std::string& path, unsigned char type,
+                 bool follow_symlinks) {
+  if (type == DT_DIR) {
+    return true;
+  }
+  if (type != DT_UNKNOWN && (type != DT_LNK || !follow_symlinks)) {
+    return false;
+  }
+  struct stat f_stat;
+  const int ret = follow_symlinks ? stat(path.c_str(), &f_stat)
+                                  : lstat(path.c_str(), &f_stat);
+  return ret == 0 && S_ISDIR(f_stat.st_mode);
+}
+#endif  // _WIN32
+
+}  // namespace
+
+// Matches compiled patterns against paths and against the file system.
+class GlobMatcher {
+ public:
+  using Token = GlobPattern::Token;
+  using Component = GlobPattern::Component;
+  using Alternative = GlobPattern::Alternative;
+
+  static absl::StatusOr<Component> CompileComponent(absl::string_view text,
+                                                    absl::string_view whole) {
+    Component component;
+    if (text == "**") {
+      component.recursive = true;
+      return component;
+    }
+    bool literal = true;
+    for (size_t i = 0; i < text.size(); ++i) {
+      Token token;
+      const char c = text[i];
+      if (c == '\\') {
+        if (++i == text.size()) {
+          return InvalidPattern(whole, "trailing '\\'");
+        }
+        token.c = text[i];
+      } else if (c == '*') {
+        literal = false;
+        if (!component.tokens.empty() &&
+            component.tokens.back().kind == Token::Kind::kStar) {
+          continue;
+        }
+        token.kind = Token::Kind::kStar;
+      } else if (c == '?') {
+        literal = false;
+        token.kind = Token::Kind::kAnyChar;
+      } else if (c == '[') {
+        literal = false;
+        const size_t end = ClassEnd(text, i);
+        if (end == absl::string_view::npos) {
+          return InvalidPattern(whole, "unterminated '['");
+        }
+        token.kind = Token::Kind::kClass;
+        size_t j = i + 1;
+        const bool negated = text[j] == '!' || text[j] == '^';
+        if (negated) {
+          ++j;
+        }
+        for (bool first = true; j < end; first = false) {
+          if (text[j] == ']' && !first) {
+            break;
+          }
+          unsigned char lo = text[j] == '\\' ? text[++j] : text[j];
+          ++j;
+          unsigned char hi = lo;
+          if (j + 1 < end && text[j] == '-') {
+            hi = text[j + 1] == '\\' ? text[j + 2] : text[j + 1];
+            j += text[j + 1] == '\\' ? 3 : 2;
+          }
+          for (int ch = lo; ch <= hi; ++ch) {
+            token.chars.set(ch);
+          }
+        }
+        if (negated) {
+          token.chars.flip();
+          token.chars.reset('/');
+        }
+        i = end;
+      } else {
+        token.c = c;
+      }
+      component.tokens.push_back(token);
+    }
+    component.literal = literal;
+    if (literal) {
+      for (const Token& token : component.tokens) {
+        component.text += token.c;
+      }
+    }
+    return component;
+  }
+
+  static bool MatchesChar(const Token& token, char c) {
+    switch (token.kind) {
+      case Token::Kind::kChar:
+        return token.c == c;
+      case Token::Kind::kAnyChar:
+        return true;
+      case Token::Kind::kClass:
+        return token.chars.test(static_cast<unsigned char>(c));
+      case Token::Kind::kStar:
+        break;
+    }
+    return false;
+  }
+
+  static bool MatchesComponent(const Component& component,
+                               absl::string_view name) {
+    if (component.literal) {
+      return name == component.text;
+    }
+    const std::vector<Token>& tokens = component.tokens;
+    if (IsHidden(name) && (tokens.empty() ||
+                           tokens[0].kind != Token::Kind::kChar ||
+                           tokens[0].c != '.')) {
+      return false;
+    }
+    // Greedy matching that backtracks to the last '*' only, which is enough
+    // because a later '*' can absorb anything an earlier one could.
+    size_t t = 0, n = 0;
+    size_t star_t = std::string::npos, star_n = 0;
+    while (n < name.size()) {
+      if (t < tokens.size() && tokens[t].kind == Token::Kind::kStar) {
+        star_t = t++;
+        star_n = n;
+      } else if (t < tokens.size() && MatchesChar(tokens[t], name[n])) {
+        ++t;
+        ++n;
+      } else if (star_t != std::string::npos) {
+        t = star_t + 1;
+        n = ++star_n;
+      } else {
+        return false;
+      }
+    }
+    while (t < tokens.size() && tokens[t].kind == Token::Kind::kStar) {
+      ++t;
+    }
+    return t == tokens.size();
+  }
+
+  static bool MatchesPath(const std::vector<Component>& components, size_t c,
+                          const std::vector<absl::string_view>& parts,
+                          size_t p) {
+    if (c == components.size()) {
+      return p == parts.size();
+    }
+    if (components[c].recursive) {
+      for (size_t end = p; end <= parts.size(); ++end) {
+        if (end > p && IsHidden(parts[end - 1])) {
+          break;
+        }
+        if (MatchesPath(components, c + 1, parts, end)) {
+          return true;
+        }
+      }
+      return false;
+    }
+    return p < parts.size() && MatchesComponent(components[c], parts[p]) &&
+           MatchesPath(components, c + 1, parts, p + 1);
+  }
+
+#ifndef _WIN32
+  static void Expand(const GlobPattern& pattern,
+                     std::vector<std::string>* results) {
+    for (const Alternative& alternative : pattern.alternatives_) {
+      Expand(alternative.components, 0, alternative.absolute ? "/" : "",
+             results);
+    }
+  }
+
+  // Appends the paths below "path" that match components[c...].
+  static void Expand(const std::vector<Component>& components, size_t c,
+                     const std::string& path,
+                     std::vector<std::string>* results) {
+    if (c == components.size()) {
+      if (!path.empty()) {
+        results->push_back(path);
+      }
+      return;
+    }
+    const Component& component = components[c];
+    const bool last = c + 1 == components.size();
+    if (component.literal) {
+      // No need to list the directory to find a known name.
+      const std::string child = JoinPath(path, component.text);
+      struct stat f_stat;
+      if (last ? lstat(child.c_str(), &f_stat) == 0
+               : stat(child.c_str(), &f_stat) == 0 &&
+                     S_ISDIR(f_stat.st_mode)) {
+        Expand(components, c + 1, child, results);
+      }
+      return;
+    }
+    if (component.recursive) {
+      Expand(components, c + 1, path, results);
+      for (const ListedEntry& entry : ListDirectory(path)) {
+        const std::string child = JoinPath(path, entry.name);
+        // Symbolic links are not followed, which avoids cycles.
+        if (!IsHidden(entry.name) &&
+            IsDirectory(child, entry.type, /*follow_symlinks=*/false)) {
+          Expand(components, c, child, results);
+        }
+      }
+      return;
+    }
+    for (const ListedEntry& entry : ListDirectory(path)) {
+      if (!MatchesComponent(component, entry.name)) {
+        continue;
+      }
+      const std::string child = JoinPath(path, entry.name);
+      if (last) {
+        results->push_back(child);
+      } else if (IsDirectory(child, entry.type, /*follow_symlinks=*/true)) {
+        Expand(components, c + 1, child, results);
+      }
+    }
+  }
+#endif  // _WIN32
+};
+
+absl::StatusOr<GlobPattern> GlobPattern::Compile(absl::string_view pattern) {
+  GlobPattern glob{std::string(pattern)};
+  std::vector<std::string> expanded;
+  RETURN_IF_ERROR(ExpandBraces(pattern, pattern, &expanded));
+  for (const std::string& alternative_pattern : expanded) {
+    Alternative alternative;
+    alternative.absolute = absl::StartsWith(alternative_pattern, "/");
+    for (absl::string_view text :
+         absl::StrSplit(alternative_pattern, '/', absl::SkipEmpty())) {
+      ASSIGN_OR_RETURN(Component component,
+                       GlobMatcher::CompileComponent(text, pattern));
+      alternative.components.push_back(std::move(component));
+    }
+    glob.alternatives_.push_back(std::move(alternative));
+  }
+  return glob;
+}
+
+bool GlobPattern::Matches(absl::string_view path) const {
+  const std::vector<absl::string_view> parts =
+      absl::StrSplit(path, '/', absl::SkipEmpty());
+  for (const Alternative& alternative : alternatives_) {
+    if (alternative.absolute == absl::StartsWith(path, "/") &&
+        GlobMatcher::MatchesPath(alternative.components, 0, parts, 0)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+absl::Status Match(absl::string_view pattern,
+                   std::vector<std::string>* results) {
+  ASSIGN_OR_RETURN(GlobPattern glob, GlobPattern::Compile(pattern));
+  return Match(glob, results);
+}
+
+absl::Status Match(const GlobPattern& pattern,
+                   std::vector<std::string>* results) {
+#ifndef _WIN32
+  const size_t begin = results->size();
+  GlobMatcher::Expand(pattern, results);
+  std::sort(results->begin() + begin, results->end());
+  results->erase(std::unique(results->begin() + begin, results->end()),
+                 results->end());
+  return absl::OkStatus();
+#else   // _WIN32
+  return absl::UnimplementedError(
+      absl::StrCat("Cannot match '", pattern.pattern(),
+                   "': not supported on this platform"));
+#endif  // _WIN32
+}
+
+}  // namespace gxl
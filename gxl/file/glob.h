@@ -0,0 +1,95 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GXL_FILE_GLOB_H_
+#define GXL_FILE_GLOB_H_
+
+#include <bitset>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+
+namespace gxl {
+
+// A compiled glob pattern. The syntax is the shell's:
+//
+//   *       any sequence of characters within a path component
+//   ?       any single character other than '/'
+//   [abc]   one of the listed characters; ranges like [a-z] and negation
+//           like [!a-z] or [^a-z] are supported
+//   {a,b}   either alternative; alternatives may contain '/' and nest
+//   **      as a whole path component, zero or more directories
+//   \c      the character c literally
+//
+// As in the shell, wildcards do not match a leading '.' of a path component,
+// so hidden files are only matched by patterns that spell out the '.'.
+class GlobPattern {
+ public:
+  // Returns kInvalidArgument for an unterminated '[' or '{' or a trailing
+  // backslash.
+  static absl::StatusOr<GlobPattern> Compile(absl::string_view pattern);
+
+  // Returns true if the whole of "path" matches the pattern.
+  bool Matches(absl::string_view path) const;
+
+  const std::string& pattern() const { return pattern_; }
+
+ private:
+  friend class GlobMatcher;
+
+  struct Token {
+    enum class Kind { kChar, kAnyChar, kStar, kClass };
+    Kind kind = Kind::kChar;
+    char c = 0;              // For kChar.
+    std::bitset<256> chars;  // For kClass, after negation.
+  };
+
+  // A path component of one brace alternative.
+  struct Component {
+    bool recursive = false;  // "**".
+    bool literal = false;    // No wildcards; "text" is the unescaped name.
+    std::string text;
+    std::vector<Token> tokens;
+  };
+
+  struct Alternative {
+    bool absolute = false;
+    std::vector<Component> components;
+  };
+
+  explicit GlobPattern(std::string pattern) : pattern_(std::move(pattern)) {}
+
+  std::string pattern_;
+  std::vector<Alternative> alternatives_;
+};
+
+// Appends the existing paths matching "pattern" to "results", sorted and
+// without duplicates.
+//
+// Components without wildcards are checked with a single stat() instead of
+// listing their parent directory, so a pattern like
+// "/data/run-*/output/part-?????" only lists "/data" and the "run-*"
+// directories' own "output" subdirectories. Unreadable directories are
+// treated as empty.
+absl::Status Match(absl::string_view pattern,
+                   std::vector<std::string>* results);
+absl::Status Match(const GlobPattern& pattern,
+                   std::vector<std::string>* results);
+
+}  // namespace gxl
+
+#endif  // GXL_FILE_GLOB_H_
@@ -0,0 +1,143 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gxl/file/glob.h"
+
+#include <string>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "gxl/file/file.h"
+#include "gxl/file/filesystem.h"
+#include "gxl/file/path.h"
+
+namespace gxl {
+namespace {
+
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+
+bool Matches(absl::string_view pattern, absl::string_view path) {
+  absl::StatusOr<GlobPattern> glob = GlobPattern::Compile(pattern);
+  EXPECT_TRUE(glob.ok()) << glob.status();
+  return glob.ok() && glob->Matches(path);
+}
+
+TEST(GlobPatternTest, Wildcards) {
+  EXPECT_TRUE(Matches("*.txt", "a.txt"));
+  EXPECT_FALSE(Matches("*.txt", "a.txt.gz"));
+  EXPECT_FALSE(Matches("*.txt", "dir/a.txt"));
+  EXPECT_TRUE(Matches("part-?????", "part-00001"));
+  EXPECT_FALSE(Matches("part-?????", "part-0001"));
+  EXPECT_TRUE(Matches("a*b*c", "aXXbYYbc"));
+  EXPECT_TRUE(Matches("\\*", "*"));
+  EXPECT_FALSE(Matches("\\*", "a"));
+}
+
+TEST(GlobPatternTest, CharacterClasses) {
+  EXPECT_TRUE(Matches("[abc]", "b"));
+  EXPECT_FALSE(Matches("[abc]", "d"));
+  EXPECT_TRUE(Matches("[a-c][0-9]", "c7"));
+  EXPECT_TRUE(Matches("[!a-c]", "d"));
+  EXPECT_FALSE(Matches("[^a-c]", "a"));
+  EXPECT_TRUE(Matches("[]]", "]"));
+}
+
+TEST(GlobPatternTest, Braces) {
+  EXPECT_TRUE(Matches("{train,test}/*.rio", "train/x.rio"));
+  EXPECT_TRUE(Matches("{train,test}/*.rio", "test/x.rio"));
+  EXPECT_FALSE(Matches("{train,test}/*.rio", "dev/x.rio"));
+  EXPECT_TRUE(Matches("a{b,c{d,e}}f", "acef"));
+  EXPECT_TRUE(Matches("x.{a/b,c}", "x.a/b"));
+}
+
+TEST(GlobPatternTest, RecursiveWildcard) {
+  EXPECT_TRUE(Matches("a/**/b", "a/b"));
+  EXPECT_TRUE(Matches("a/**/b", "a/x/y/b"));
+  EXPECT_FALSE(Matches("a/**/b", "a/x/y/c"));
+  EXPECT_FALSE(Matches("a/**/b", "a/.hidden/b"));
+  EXPECT_TRUE(Matches("/**/*.cc", "/src/file.cc"));
+  EXPECT_FALSE(Matches("/**/*.cc", "src/file.cc"));
+}
+
+TEST(GlobPatternTest, HiddenFiles) {
+  EXPECT_FALSE(Matches("*", ".hidden"));
+  EXPECT_FALSE(Matches("?hidden", ".hidden"));
+  EXPECT_TRUE(Matches(".*", ".hidden"));
+}
+
+TEST(GlobPatternTest, InvalidPatterns) {
+  EXPECT_EQ(GlobPattern::Compile("[abc").status().code(),
+            absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(GlobPattern::Compile("{a,b").status().code(),
+            absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(GlobPattern::Compile("abc\\").status().code(),
+            absl::StatusCode::kInvalidArgument);
+}
+
+class GlobMatchTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    root_ = JoinPath(testing::TempDir(), "glob_match_test");
+    for (const char* path :
+         {"out/run-1/part-00000", "out/run-1/part-00001",
+          "out/run-2/part-00000", "out/run-2/log.txt",
+          "out/run-2/deep/nested/part-00002", "out/.tmp/part-00003"}) {
+      const std::string file = JoinPath(root_, path);
+      ASSERT_TRUE(RecursivelyCreateDir(Dirname(file)).ok());
+      ASSERT_TRUE(SetContents(file, "", file::Defaults()).ok());
+    }
+  }
+
+  std::vector<std::string> Match(absl::string_view pattern) {
+    std::vector<std::string> results;
+    EXPECT_TRUE(gxl::Match(JoinPath(root_, pattern), &results).ok());
+    for (std::string& result : results) {
+      result = result.substr(root_.size() + 1);
+    }
+    return results;
+  }
+
+  std::string root_;
+};
+
+TEST_F(GlobMatchTest, Wildcards) {
+  EXPECT_THAT(Match("out/run-*/part-?????"),
+              ElementsAre("out/run-1/part-00000", "out/run-1/part-00001",
+                          "out/run-2/part-00000"));
+  EXPECT_THAT(Match("out/run-[2-9]/*"),
+              ElementsAre("out/run-2/deep", "out/run-2/log.txt",
+                          "out/run-2/part-00000"));
+  EXPECT_THAT(Match("out/run-*/missing"), IsEmpty());
+  EXPECT_THAT(Match("no/such/dir/*"), IsEmpty());
+}
+
+TEST_F(GlobMatchTest, BracesAndLiterals) {
+  EXPECT_THAT(Match("out/{run-1/part-00001,run-2/log.txt,run-3/x}"),
+              ElementsAre("out/run-1/part-00001", "out/run-2/log.txt"));
+}
+
+TEST_F(GlobMatchTest, RecursiveWildcard) {
+  EXPECT_THAT(Match("out/**/part-*"),
+              ElementsAre("out/run-1/part-00000", "out/run-1/part-00001",
+                          "out/run-2/deep/nested/part-00002",
+                          "out/run-2/part-00000"));
+  EXPECT_THAT(Match("out/.tmp/*"), ElementsAre("out/.tmp/part-00003"));
+}
+
+}  // namespace
+}  // namespace gxl
@@ -0,0 +1,35 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gxl/file/internal/compression_hooks.h"
+
+#include <atomic>
+
+namespace gxl {
+namespace internal {
+namespace {
+
+std::atomic<const CompressionHooks*> registered_hooks{nullptr};
+
+}  // namespace
+
+void RegisterCompressionHooks(const CompressionHooks* hooks) {
+  registered_hooks.store(hooks, std::memory_order_release);
+}
+
+const CompressionHooks* GetCompressionHooks() {
+  return registered_hooks.load(std::memory_order_acquire);
+}
+
+}  // namespace internal
+}  // namespace gxl
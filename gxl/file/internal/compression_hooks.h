@@ -0,0 +1,55 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GXL_FILE_INTERNAL_COMPRESSION_HOOKS_H_
+#define GXL_FILE_INTERNAL_COMPRESSION_HOOKS_H_
+
+#include <cstdio>
+#include <string>
+
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+
+namespace gxl {
+namespace internal {
+
+// The codecs behind file::kCompression and File::OpenCompressed(). The
+// "compression" target registers them when it is linked in, so that binaries
+// using only the "file" target do not link zlib and zstd.
+// Not part of the public API.
+struct CompressionHooks {
+  // compression_internal::OpenStream() with the default options.
+  FILE* (*open_stream)(absl::string_view filename, absl::string_view mode);
+
+  // Returns true if files named "filename" are compressed on writing.
+  bool (*compresses)(absl::string_view filename);
+
+  // Compresses "input" for the file "filename".
+  absl::Status (*compress)(absl::string_view filename,
+                           absl::string_view input, std::string* output);
+
+  // Decompress() from compression.h.
+  absl::Status (*decompress)(absl::string_view input, std::string* output);
+};
+
+// "hooks" must outlive all file operations.
+void RegisterCompressionHooks(const CompressionHooks* hooks);
+
+// Returns the registered hooks, or nullptr if the "compression" target is
+// not linked in.
+const CompressionHooks* GetCompressionHooks();
+
+}  // namespace internal
+}  // namespace gxl
+
+#endif  // GXL_FILE_INTERNAL_COMPRESSION_HOOKS_H_
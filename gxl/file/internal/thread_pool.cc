@@ -0,0 +1,121 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gxl/file/internal/thread_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>  // NOLINT
+#include <utility>
+
+#include "absl/functional/any_invocable.h"
+#include "absl/functional/function_ref.h"
+#include "absl/status/status.h"
+#include "absl/synchronization/mutex.h"
+#include "gxl/status/status_macros.h"
+
+namespace gxl {
+namespace internal {
+
+ThreadPool::ThreadPool(int num_threads) {
+  if (num_threads <= 0) {
+    num_threads = DefaultNumThreads();
+  }
+  threads_.reserve(num_threads);
+  for (int i = 0; i < num_threads; ++i) {
+    threads_.emplace_back([this] { WorkLoop(); });
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    absl::MutexLock lock(&mu_);
+    stopping_ = true;
+  }
+  for (std::thread& thread : threads_) {
+    thread.join();
+  }
+}
+
+void ThreadPool::Schedule(absl::AnyInvocable<void()> fn) {
+  absl::MutexLock lock(&mu_);
+  queue_.push_back(std::move(fn));
+}
+
+int ThreadPool::DefaultNumThreads() {
+  const int n = std::thread::hardware_concurrency();
+  return n > 0 ? n : 1;
+}
+
+bool ThreadPool::HasWorkOrStopping() const {
+  return stopping_ || !queue_.empty();
+}
+
+void ThreadPool::WorkLoop() {
+  while (true) {
+    absl::AnyInvocable<void()> fn;
+    {
+      absl::MutexLock lock(&mu_);
+      mu_.Await(absl::Condition(this, &ThreadPool::HasWorkOrStopping));
+      if (queue_.empty()) {
+        return;  // Stopping and drained.
+      }
+      fn = std::move(queue_.front());
+      queue_.pop_front();
+    }
+    std::move(fn)();
+  }
+}
+
+absl::Status ParallelFor(size_t n, int num_threads,
+                         absl::FunctionRef<absl::Status(size_t)> fn) {
+  if (num_threads <= 0) {
+    num_threads = ThreadPool::DefaultNumThreads();
+  }
+  if (n <= 1 || num_threads == 1) {
+    for (size_t i = 0; i < n; ++i) {
+      RETURN_IF_ERROR(fn(i));
+    }
+    return absl::OkStatus();
+  }
+  std::atomic<size_t> next{0};
+  std::atomic<bool> failed{false};
+  absl::Mutex mu;
+  absl::Status first_error;
+  {
+    ThreadPool pool(std::min<size_t>(num_threads, n));
+    for (int t = 0; t < pool.num_threads(); ++t) {
+      pool.Schedule([&] {
+        while (!failed.load(std::memory_order_relaxed)) {
+          const size_t i = next.fetch_add(1, std::memory_order_relaxed);
+          if (i >= n) {
+            return;
+          }
+          absl::Status status = fn(i);
+          if (!status.ok()) {
+            absl::MutexLock lock(&mu);
+            if (first_error.ok()) {
+              first_error = std::move(status);
+            }
+            failed.store(true, std::memory_order_relaxed);
+          }
+        }
+      });
+    }
+  }  // Waits for the workers.
+  return first_error;
+}
+
+}  // namespace internal
+}  // namespace gxl
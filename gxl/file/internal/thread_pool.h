@@ -0,0 +1,72 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GXL_FILE_INTERNAL_THREAD_POOL_H_
+#define GXL_FILE_INTERNAL_THREAD_POOL_H_
+
+#include <cstddef>
+#include <deque>
+#include <thread>  // NOLINT
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/functional/function_ref.h"
+#include "absl/status/status.h"
+#include "absl/synchronization/mutex.h"
+
+namespace gxl {
+namespace internal {
+
+// A fixed-size pool of worker threads running closures in FIFO order.
+// Not part of the public API.
+class ThreadPool {
+ public:
+  // Starts "num_threads" workers. A value <= 0 means DefaultNumThreads().
+  explicit ThreadPool(int num_threads);
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  // Runs all closures scheduled so far, then joins the workers.
+  ~ThreadPool();
+
+  // Schedules "fn" to run on one of the workers.
+  void Schedule(absl::AnyInvocable<void()> fn);
+
+  int num_threads() const { return threads_.size(); }
+
+  // Returns the number of hardware threads, or 1 if it is unknown.
+  static int DefaultNumThreads();
+
+ private:
+  bool HasWorkOrStopping() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void WorkLoop();
+
+  absl::Mutex mu_;
+  std::deque<absl::AnyInvocable<void()>> queue_ ABSL_GUARDED_BY(mu_);
+  bool stopping_ ABSL_GUARDED_BY(mu_) = false;
+  std::vector<std::thread> threads_;
+};
+
+// Calls "fn" on every index in [0, n), on up to "num_threads" threads, of
+// which <= 0 means ThreadPool::DefaultNumThreads(). Once a call fails, the
+// indices not started yet are skipped, and the first error is returned. Runs
+// on the calling thread if one thread is enough.
+absl::Status ParallelFor(size_t n, int num_threads,
+                         absl::FunctionRef<absl::Status(size_t)> fn);
+
+}  // namespace internal
+}  // namespace gxl
+
+#endif  // GXL_FILE_INTERNAL_THREAD_POOL_H_
@@ -0,0 +1,71 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gxl/file/internal/thread_pool.h"
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "gtest/gtest.h"
+
+namespace gxl {
+namespace internal {
+namespace {
+
+TEST(ThreadPoolTest, RunsScheduledClosuresBeforeDestruction) {
+  std::atomic<int> runs{0};
+  {
+    ThreadPool pool(3);
+    EXPECT_EQ(pool.num_threads(), 3);
+    for (int i = 0; i < 100; ++i) {
+      pool.Schedule([&runs] { runs.fetch_add(1); });
+    }
+  }
+  EXPECT_EQ(runs.load(), 100);
+}
+
+TEST(ParallelForTest, CallsEveryIndexOnce) {
+  for (const int num_threads : {0, 1, 4}) {
+    std::vector<std::atomic<int>> calls(1000);
+    EXPECT_TRUE(ParallelFor(calls.size(), num_threads, [&calls](size_t i) {
+                  calls[i].fetch_add(1);
+                  return absl::OkStatus();
+                }).ok());
+    for (size_t i = 0; i < calls.size(); ++i) {
+      EXPECT_EQ(calls[i].load(), 1) << i << " with " << num_threads;
+    }
+  }
+  EXPECT_TRUE(ParallelFor(0, 4, [](size_t) {
+                ADD_FAILURE();
+                return absl::OkStatus();
+              }).ok());
+}
+
+TEST(ParallelForTest, StopsAtAnError) {
+  for (const int num_threads : {1, 4}) {
+    std::atomic<int> calls{0};
+    const absl::Status status =
+        ParallelFor(100000, num_threads, [&calls](size_t i) {
+          calls.fetch_add(1);
+          return i == 10 ? absl::InternalError("ten") : absl::OkStatus();
+        });
+    EXPECT_EQ(status, absl::InternalError("ten"));
+    EXPECT_LT(calls.load(), 100000);
+  }
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace gxl
@@ -0,0 +1,231 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gxl/file/io_stats.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>  // NOLINT
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "absl/base/const_init.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/strings/match.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/synchronization/mutex.h"
+
+namespace gxl {
+namespace {
+
+struct AtomicOpStats {
+  std::atomic<int64_t> count{0};
+  std::atomic<int64_t> bytes{0};
+  std::atomic<int64_t> total_latency_nanos{0};
+  std::array<std::atomic<int64_t>, IoOpStats::kNumLatencyBuckets>
+      latency_buckets = {};
+
+  void Record(int64_t num_bytes, int64_t latency_nanos) {
+    count.fetch_add(1, std::memory_order_relaxed);
+    bytes.fetch_add(num_bytes, std::memory_order_relaxed);
+    total_latency_nanos.fetch_add(latency_nanos, std::memory_order_relaxed);
+    const uint64_t micros = std::max<int64_t>(latency_nanos, 0) / 1000;
+    const int bucket = std::min<int>(std::bit_width(micros),
+                                     IoOpStats::kNumLatencyBuckets - 1);
+    latency_buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  IoOpStats Load() const {
+    IoOpStats stats;
+    stats.count = count.load(std::memory_order_relaxed);
+    stats.bytes = bytes.load(std::memory_order_relaxed);
+    stats.total_latency_nanos =
+        total_latency_nanos.load(std::memory_order_relaxed);
+    for (int i = 0; i < IoOpStats::kNumLatencyBuckets; ++i) {
+      stats.latency_buckets[i] =
+          latency_buckets[i].load(std::memory_order_relaxed);
+    }
+    return stats;
+  }
+};
+
+using AtomicOpStatsArray = std::array<AtomicOpStats, kNumIoOps>;
+
+struct State {
+  State(const IoStatsOptions& options, uint64_t epoch)
+      : epoch(epoch),
+        prefixes(options.path_prefixes),
+        prefix_ops(prefixes.size()) {}
+
+  // Distinguishes the states of successive EnableIoStats() calls.
+  const uint64_t epoch;
+  const std::vector<std::string> prefixes;
+  AtomicOpStatsArray ops;
+  std::vector<AtomicOpStatsArray> prefix_ops;
+};
+
+// Held exclusively only to replace the state, so that recording threads
+// share it.
+ABSL_CONST_INIT absl::Mutex state_mutex(absl::kConstInit);
+ABSL_CONST_INIT State* state ABSL_GUARDED_BY(state_mutex) = nullptr;
+ABSL_CONST_INIT uint64_t last_epoch ABSL_GUARDED_BY(state_mutex) = 0;
+
+// Formats the bound returned by LatencyPercentileMicros().
+std::string PercentileString(const IoOpStats& stats, double p) {
+  const int64_t micros = stats.LatencyPercentileMicros(p);
+  if (micros == std::numeric_limits<int64_t>::max()) {
+    return absl::StrCat(">=", IoOpStats::kOverflowMicros, "us");
+  }
+  return absl::StrCat("<=", micros, "us");
+}
+
+void AppendOpStats(absl::string_view prefix, const IoOpStats& stats,
+                   IoOp op, std::string* out) {
+  if (stats.count == 0) {
+    return;
+  }
+  absl::StrAppend(out, prefix, IoOpName(op), ": count=", stats.count,
+                  " bytes=", stats.bytes, " mean=",
+                  stats.total_latency_nanos / stats.count / 1000, "us p50",
+                  PercentileString(stats, 50), " p99",
+                  PercentileString(stats, 99), "\n");
+}
+
+}  // namespace
+
+absl::string_view IoOpName(IoOp op) {
+  switch (op) {
+    case IoOp::kOpen:
+      return "Open";
+    case IoOp::kRead:
+      return "Read";
+    case IoOp::kWrite:
+      return "Write";
+    case IoOp::kFlush:
+      return "Flush";
+    case IoOp::kClose:
+      return "Close";
+    case IoOp::kGetContents:
+      return "GetContents";
+  }
+  return "Unknown";
+}
+
+int64_t IoOpStats::LatencyPercentileMicros(double p) const {
+  if (count == 0) {
+    return 0;
+  }
+  const int64_t rank = std::max<int64_t>(
+      1, static_cast<int64_t>(std::ceil(std::clamp(p, 0.0, 100.0) / 100 *
+                                        count)));
+  int64_t seen = 0;
+  for (int i = 0; i < kNumLatencyBuckets - 1; ++i) {
+    seen += latency_buckets[i];
+    if (seen >= rank) {
+      return int64_t{1} << i;
+    }
+  }
+  return std::numeric_limits<int64_t>::max();
+}
+
+std::string IoStatsSnapshot::DebugString() const {
+  std::string out;
+  for (int i = 0; i < kNumIoOps; ++i) {
+    AppendOpStats("", ops[i], static_cast<IoOp>(i), &out);
+  }
+  for (const PrefixStats& prefix_stats : prefixes) {
+    const std::string prefix = absl::StrCat(prefix_stats.prefix, " ");
+    for (int i = 0; i < kNumIoOps; ++i) {
+      AppendOpStats(prefix, prefix_stats.ops[i], static_cast<IoOp>(i), &out);
+    }
+  }
+  return out;
+}
+
+void EnableIoStats(const IoStatsOptions& options) {
+  absl::MutexLock lock(&state_mutex);
+  delete state;
+  state = new State(options, ++last_epoch);
+  io_stats_internal::enabled.store(true, std::memory_order_relaxed);
+}
+
+void DisableIoStats() {
+  io_stats_internal::enabled.store(false, std::memory_order_relaxed);
+}
+
+IoStatsSnapshot GetIoStats() {
+  IoStatsSnapshot snapshot;
+  absl::ReaderMutexLock lock(&state_mutex);
+  if (state == nullptr) {
+    return snapshot;
+  }
+  for (int i = 0; i < kNumIoOps; ++i) {
+    snapshot.ops[i] = state->ops[i].Load();
+  }
+  for (size_t p = 0; p < state->prefixes.size(); ++p) {
+    IoStatsSnapshot::PrefixStats& prefix_stats =
+        snapshot.prefixes.emplace_back();
+    prefix_stats.prefix = state->prefixes[p];
+    for (int i = 0; i < kNumIoOps; ++i) {
+      prefix_stats.ops[i] = state->prefix_ops[p][i].Load();
+    }
+  }
+  return snapshot;
+}
+
+namespace io_stats_internal {
+
+std::atomic<bool> enabled{false};
+
+int IoTimer::FindPrefix(absl::string_view path, uint64_t* epoch) {
+  absl::ReaderMutexLock lock(&state_mutex);
+  int longest = -1;
+  if (state == nullptr) {
+    return longest;
+  }
+  *epoch = state->epoch;
+  for (size_t p = 0; p < state->prefixes.size(); ++p) {
+    if (absl::StartsWith(path, state->prefixes[p]) &&
+        (longest < 0 ||
+         state->prefixes[p].size() > state->prefixes[longest].size())) {
+      longest = p;
+    }
+  }
+  return longest;
+}
+
+void IoTimer::Record(IoOp op, int prefix, uint64_t epoch, int64_t bytes,
+                     std::chrono::steady_clock::duration latency) {
+  const int64_t latency_nanos =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(latency).count();
+  absl::ReaderMutexLock lock(&state_mutex);
+  // The operation started before the statistics were restarted, possibly
+  // with other prefixes: it belongs to neither set.
+  if (state == nullptr || state->epoch != epoch) {
+    return;
+  }
+  state->ops[static_cast<int>(op)].Record(bytes, latency_nanos);
+  if (prefix >= 0) {
+    state->prefix_ops[prefix][static_cast<int>(op)].Record(bytes,
+                                                           latency_nanos);
+  }
+}
+
+}  // namespace io_stats_internal
+}  // namespace gxl
@@ -0,0 +1,153 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Opt-in statistics on the I/O done through gxl/file: operation counts,
+// bytes and latency histograms, in total and per path prefix.
+//
+// Usage:
+//
+//   EnableIoStats({.path_prefixes = {"/data/models/", "/etc/app/"}});
+//   ... load everything ...
+//   LOG(INFO) << GetIoStats().DebugString();
+//
+// While disabled, which is the default, an operation costs one relaxed
+// atomic load more.
+
+#ifndef GXL_FILE_IO_STATS_H_
+#define GXL_FILE_IO_STATS_H_
+
+#include <array>
+#include <atomic>
+#include <chrono>  // NOLINT
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+
+namespace gxl {
+
+// The instrumented operations. For File, kRead and kWrite are the stream
+// reads and writes; positional reads and writes are not counted.
+enum class IoOp {
+  kOpen,
+  kRead,
+  kWrite,
+  kFlush,
+  kClose,
+  kGetContents,
+};
+
+inline constexpr int kNumIoOps = 6;
+
+absl::string_view IoOpName(IoOp op);
+
+// Statistics of one operation type.
+struct IoOpStats {
+  // Bucket 0 counts operations faster than 1us, bucket i > 0 those that took
+  // [2^(i-1), 2^i) us, and the last bucket everything slower, from
+  // kOverflowMicros on.
+  static constexpr int kNumLatencyBuckets = 24;
+  static constexpr int64_t kOverflowMicros = int64_t{1}
+                                             << (kNumLatencyBuckets - 2);
+
+  int64_t count = 0;
+  int64_t bytes = 0;
+  int64_t total_latency_nanos = 0;
+  std::array<int64_t, kNumLatencyBuckets> latency_buckets = {};
+
+  // Returns an upper bound of the latency percentile "p", in [0, 100], from
+  // the histogram, in microseconds. 0 if there were no operations, and
+  // std::numeric_limits<int64_t>::max() if the percentile falls in the last
+  // bucket, which has no upper bound.
+  int64_t LatencyPercentileMicros(double p) const;
+};
+
+struct IoStatsSnapshot {
+  struct PrefixStats {
+    std::string prefix;
+    std::array<IoOpStats, kNumIoOps> ops;
+  };
+
+  // All operations.
+  std::array<IoOpStats, kNumIoOps> ops;
+  // Operations on paths starting with each prefix given to EnableIoStats(),
+  // counted under the longest one that matches.
+  std::vector<PrefixStats> prefixes;
+
+  const IoOpStats& op(IoOp op) const { return ops[static_cast<int>(op)]; }
+
+  // One line per operation type and prefix with operations.
+  std::string DebugString() const;
+};
+
+struct IoStatsOptions {
+  std::vector<std::string> path_prefixes;
+};
+
+// Starts recording, from zero.
+void EnableIoStats(const IoStatsOptions& options);
+
+// Stops recording. The statistics so far remain available.
+void DisableIoStats();
+
+IoStatsSnapshot GetIoStats();
+
+namespace io_stats_internal {
+// Not part of the public API.
+
+extern std::atomic<bool> enabled;
+
+// Resolves the path prefix at construction and records the operation at
+// destruction, if statistics are enabled at construction. Operations that
+// span a call to EnableIoStats() are not recorded.
+class IoTimer {
+ public:
+  IoTimer(IoOp op, absl::string_view path) : op_(op) {
+    if (enabled.load(std::memory_order_relaxed)) {
+      prefix_ = FindPrefix(path, &epoch_);
+      start_ = std::chrono::steady_clock::now();
+    }
+  }
+
+  IoTimer(const IoTimer&) = delete;
+  IoTimer& operator=(const IoTimer&) = delete;
+
+  ~IoTimer() {
+    if (prefix_ != kDisabled) {
+      Record(op_, prefix_, epoch_, bytes_,
+             std::chrono::steady_clock::now() - start_);
+    }
+  }
+
+  void set_bytes(int64_t bytes) { bytes_ = bytes; }
+
+ private:
+  static constexpr int kDisabled = -2;  // -1 is "no matching prefix".
+
+  // Also stores the epoch of the statistics that "path" was matched against.
+  static int FindPrefix(absl::string_view path, uint64_t* epoch);
+  static void Record(IoOp op, int prefix, uint64_t epoch, int64_t bytes,
+                     std::chrono::steady_clock::duration latency);
+
+  const IoOp op_;
+  int prefix_ = kDisabled;
+  uint64_t epoch_ = 0;
+  int64_t bytes_ = 0;
+  std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace io_stats_internal
+}  // namespace gxl
+
+#endif  // GXL_FILE_IO_STATS_H_
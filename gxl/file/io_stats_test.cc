@@ -0,0 +1,153 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gxl/file/io_stats.h"
+
+#include <cstdint>
+#include <limits>
+#include <string>
+
+#include "absl/strings/match.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "gtest/gtest.h"
+#include "gxl/file/file.h"
+#include "gxl/file/filesystem.h"
+
+namespace gxl {
+namespace {
+
+std::string TestDir(absl::string_view name) {
+  return absl::StrCat(testing::TempDir(), "/", name);
+}
+
+TEST(IoOpStatsTest, LatencyPercentileMicros) {
+  IoOpStats stats;
+  EXPECT_EQ(stats.LatencyPercentileMicros(50), 0);
+
+  stats.count = 100;
+  stats.latency_buckets[0] = 50;   // < 1us.
+  stats.latency_buckets[4] = 40;   // [8us, 16us).
+  stats.latency_buckets[10] = 10;  // [512us, 1024us).
+  EXPECT_EQ(stats.LatencyPercentileMicros(0), 1);
+  EXPECT_EQ(stats.LatencyPercentileMicros(50), 1);
+  EXPECT_EQ(stats.LatencyPercentileMicros(51), 16);
+  EXPECT_EQ(stats.LatencyPercentileMicros(90), 16);
+  EXPECT_EQ(stats.LatencyPercentileMicros(91), 1024);
+  EXPECT_EQ(stats.LatencyPercentileMicros(100), 1024);
+  EXPECT_EQ(stats.LatencyPercentileMicros(200), 1024);
+}
+
+TEST(IoOpStatsTest, LatencyPercentileMicrosOverflow) {
+  IoOpStats stats;
+  stats.count = 2;
+  stats.latency_buckets[IoOpStats::kNumLatencyBuckets - 2] = 1;
+  stats.latency_buckets[IoOpStats::kNumLatencyBuckets - 1] = 1;
+  EXPECT_EQ(stats.LatencyPercentileMicros(50), IoOpStats::kOverflowMicros);
+  EXPECT_EQ(stats.LatencyPercentileMicros(100),
+            std::numeric_limits<int64_t>::max());
+}
+
+TEST(IoStatsTest, CountsOperationsByLongestPrefix) {
+  const std::string dir = TestDir("io_stats_prefix");
+  const std::string subdir = absl::StrCat(dir, "/sub");
+  ASSERT_TRUE(RecursivelyCreateDir(subdir).ok());
+
+  EnableIoStats({.path_prefixes = {dir, subdir, "/nonexistent"}});
+  ASSERT_TRUE(
+      SetContents(absl::StrCat(dir, "/a"), "12345", file::Defaults()).ok());
+  ASSERT_TRUE(
+      SetContents(absl::StrCat(subdir, "/b"), "123", file::Defaults()).ok());
+  std::string contents;
+  ASSERT_TRUE(
+      GetContents(absl::StrCat(dir, "/a"), &contents, file::Defaults()).ok());
+  ASSERT_TRUE(
+      GetContents(absl::StrCat(subdir, "/b"), &contents, file::Defaults())
+          .ok());
+  ASSERT_TRUE(
+      GetContents(absl::StrCat(subdir, "/b"), &contents, file::Defaults())
+          .ok());
+  DisableIoStats();
+  ASSERT_TRUE(
+      GetContents(absl::StrCat(dir, "/a"), &contents, file::Defaults()).ok());
+
+  const IoStatsSnapshot stats = GetIoStats();
+  EXPECT_EQ(stats.op(IoOp::kGetContents).count, 3);
+  EXPECT_EQ(stats.op(IoOp::kGetContents).bytes, 11);
+  ASSERT_EQ(stats.prefixes.size(), 3);
+  EXPECT_EQ(stats.prefixes[0].prefix, dir);
+  EXPECT_EQ(stats.prefixes[1].prefix, subdir);
+  const int get_contents = static_cast<int>(IoOp::kGetContents);
+  EXPECT_EQ(stats.prefixes[0].ops[get_contents].count, 1);
+  EXPECT_EQ(stats.prefixes[0].ops[get_contents].bytes, 5);
+  EXPECT_EQ(stats.prefixes[1].ops[get_contents].count, 2);
+  EXPECT_EQ(stats.prefixes[1].ops[get_contents].bytes, 6);
+  EXPECT_EQ(stats.prefixes[2].ops[get_contents].count, 0);
+
+  const std::string debug_string = stats.DebugString();
+  EXPECT_TRUE(absl::StrContains(debug_string, "GetContents: count=3 bytes=11"))
+      << debug_string;
+  EXPECT_TRUE(absl::StrContains(
+      debug_string, absl::StrCat(subdir, " GetContents: count=2 bytes=6")))
+      << debug_string;
+  EXPECT_FALSE(absl::StrContains(debug_string, "/nonexistent"))
+      << debug_string;
+}
+
+TEST(IoStatsTest, EnableRestartsFromZero) {
+  const std::string filename = TestDir("io_stats_restart");
+  EnableIoStats({.path_prefixes = {filename}});
+  ASSERT_TRUE(SetContents(filename, "abc", file::Defaults()).ok());
+  EXPECT_GT(GetIoStats().op(IoOp::kOpen).count, 0);
+
+  EnableIoStats({});
+  const IoStatsSnapshot stats = GetIoStats();
+  EXPECT_EQ(stats.op(IoOp::kOpen).count, 0);
+  EXPECT_TRUE(stats.prefixes.empty());
+  DisableIoStats();
+}
+
+TEST(IoStatsTest, DropsOperationsSpanningEnable) {
+  EnableIoStats({.path_prefixes = {"/a", "/a/b"}});
+  {
+    io_stats_internal::IoTimer timer(IoOp::kRead, "/a/b/c");
+    timer.set_bytes(10);
+    // The prefixes the timer matched are gone when it records.
+    EnableIoStats({.path_prefixes = {"/a"}});
+  }
+  {
+    io_stats_internal::IoTimer timer(IoOp::kRead, "/a/b/c");
+    timer.set_bytes(20);
+  }
+  DisableIoStats();
+
+  const IoStatsSnapshot stats = GetIoStats();
+  EXPECT_EQ(stats.op(IoOp::kRead).count, 1);
+  EXPECT_EQ(stats.op(IoOp::kRead).bytes, 20);
+  ASSERT_EQ(stats.prefixes.size(), 1);
+  EXPECT_EQ(stats.prefixes[0].ops[static_cast<int>(IoOp::kRead)].bytes, 20);
+}
+
+TEST(IoStatsTest, DisabledRecordsNothing) {
+  EnableIoStats({});
+  DisableIoStats();
+  {
+    io_stats_internal::IoTimer timer(IoOp::kWrite, "/x");
+    timer.set_bytes(1);
+  }
+  EXPECT_EQ(GetIoStats().op(IoOp::kWrite).count, 0);
+  EXPECT_EQ(GetIoStats().DebugString(), "");
+}
+
+}  // namespace
+}  // namespace gxl
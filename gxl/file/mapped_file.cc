@@ -0,0 +1,126 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gxl/file/mapped_file.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif  // _WIN32
+
+#include <cerrno>
+#include <memory>
+#include <string>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+
+namespace gxl {
+
+#ifndef _WIN32
+namespace {
+
+int ToMadvise(MappedFile::Access access) {
+  switch (access) {
+    case MappedFile::Access::kSequential:
+      return MADV_SEQUENTIAL;
+    case MappedFile::Access::kRandom:
+      return MADV_RANDOM;
+    case MappedFile::Access::kWillNeed:
+      return MADV_WILLNEED;
+    case MappedFile::Access::kNormal:
+      break;
+  }
+  return MADV_NORMAL;
+}
+
+}  // namespace
+
+absl::StatusOr<std::unique_ptr<MappedFile>> MappedFile::Open(
+    absl::string_view filename, Access access) {
+  const std::string null_terminated_name(filename);
+  const int fd = open(null_terminated_name.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return absl::ErrnoToStatus(errno,
+                               absl::StrCat("Could not open '", filename, "'"));
+  }
+  struct stat f_stat;
+  if (fstat(fd, &f_stat) != 0) {
+    const int saved_errno = errno;
+    close(fd);
+    return absl::ErrnoToStatus(saved_errno,
+                               absl::StrCat("Could not stat '", filename, "'"));
+  }
+  if (!S_ISREG(f_stat.st_mode)) {
+    close(fd);
+    return absl::Status(
+        absl::StatusCode::kInvalidArgument,
+        absl::StrCat("Cannot map '", filename, "': not a regular file"));
+  }
+  const size_t size = f_stat.st_size;
+  if (size == 0) {
+    close(fd);
+    return std::unique_ptr<MappedFile>(new MappedFile(nullptr, 0));
+  }
+  // MAP_POPULATE only pays off when the whole file will be touched anyway.
+  int flags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+  if (access == Access::kWillNeed) {
+    flags |= MAP_POPULATE;
+  }
+#endif  // MAP_POPULATE
+  void* data = mmap(nullptr, size, PROT_READ, flags, fd, 0);
+  const int saved_errno = errno;
+  // The mapping keeps its own reference to the file.
+  close(fd);
+  if (data == MAP_FAILED) {
+    return absl::ErrnoToStatus(saved_errno,
+                               absl::StrCat("Could not map '", filename, "'"));
+  }
+  std::unique_ptr<MappedFile> mapped(new MappedFile(data, size));
+  mapped->Advise(access);
+  return mapped;
+}
+
+MappedFile::~MappedFile() {
+  if (data_ != nullptr) {
+    munmap(data_, size_);
+  }
+}
+
+void MappedFile::Advise(Access access) const {
+  if (data_ != nullptr) {
+    madvise(data_, size_, ToMadvise(access));
+  }
+}
+
+#else  // _WIN32
+
+absl::StatusOr<std::unique_ptr<MappedFile>> MappedFile::Open(
+    absl::string_view filename, Access /*access*/) {
+  return absl::Status(
+      absl::StatusCode::kUnimplemented,
+      absl::StrCat("Cannot map '", filename, "': mmap is not supported"));
+}
+
+MappedFile::~MappedFile() {}
+
+void MappedFile::Advise(Access /*access*/) const {}
+
+#endif  // _WIN32
+
+}  // namespace gxl
@@ -0,0 +1,75 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GXL_FILE_MAPPED_FILE_H_
+#define GXL_FILE_MAPPED_FILE_H_
+
+#include <cstddef>
+#include <memory>
+
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+
+namespace gxl {
+
+// A read-only memory mapping of a whole file. Loaders can parse the contents
+// in place instead of copying them into a std::string first:
+//
+//   ASSIGN_OR_RETURN(std::unique_ptr<MappedFile> mapped,
+//                    MappedFile::Open(filename));
+//   RETURN_IF_ERROR(Parse(mapped->contents()));
+//
+// The view returned by contents() is valid until the MappedFile is destroyed.
+// Modifying or truncating the underlying file while it is mapped has
+// undefined results, as with any mmap().
+class MappedFile {
+ public:
+  // Expected access pattern, passed to the kernel as an madvise() hint.
+  enum class Access {
+    kNormal,
+    kSequential,  // Aggressive read-ahead, pages freed soon after use.
+    kRandom,      // No read-ahead.
+    kWillNeed,    // Start reading the whole file in immediately.
+  };
+
+  // Maps "filename" read-only. Empty files are supported and produce an
+  // empty contents() without creating a mapping.
+  static absl::StatusOr<std::unique_ptr<MappedFile>> Open(
+      absl::string_view filename, Access access = Access::kSequential);
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  ~MappedFile();
+
+  // Returns the mapped bytes.
+  absl::string_view contents() const {
+    return absl::string_view(static_cast<const char*>(data_), size_);
+  }
+  const char* data() const { return static_cast<const char*>(data_); }
+  size_t size() const { return size_; }
+
+  // Re-issues an access hint, e.g. to switch to kRandom after a sequential
+  // header scan. Advice is best-effort and failures are ignored.
+  void Advise(Access access) const;
+
+ private:
+  MappedFile(void* data, size_t size) : data_(data), size_(size) {}
+
+  void* data_;
+  size_t size_;
+};
+
+}  // namespace gxl
+
+#endif  // GXL_FILE_MAPPED_FILE_H_
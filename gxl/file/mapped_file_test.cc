@@ -0,0 +1,58 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gxl/file/mapped_file.h"
+
+#include <memory>
+#include <string>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "gtest/gtest.h"
+#include "gxl/file/file.h"
+
+namespace gxl {
+namespace {
+
+std::string TestFile(absl::string_view name) {
+  return absl::StrCat(testing::TempDir(), "/", name);
+}
+
+TEST(MappedFileTest, MapsContents) {
+  const std::string filename = TestFile("mapped_file");
+  ASSERT_TRUE(SetContents(filename, "mapped bytes", file::Defaults()).ok());
+  absl::StatusOr<std::unique_ptr<MappedFile>> mapped =
+      MappedFile::Open(filename, MappedFile::Access::kRandom);
+  ASSERT_TRUE(mapped.ok()) << mapped.status();
+  EXPECT_EQ((*mapped)->contents(), "mapped bytes");
+}
+
+TEST(MappedFileTest, MapsEmptyFile) {
+  const std::string filename = TestFile("mapped_empty_file");
+  ASSERT_TRUE(SetContents(filename, "", file::Defaults()).ok());
+  absl::StatusOr<std::unique_ptr<MappedFile>> mapped =
+      MappedFile::Open(filename);
+  ASSERT_TRUE(mapped.ok()) << mapped.status();
+  EXPECT_TRUE((*mapped)->contents().empty());
+}
+
+TEST(MappedFileTest, MissingFileIsNotFound) {
+  absl::StatusOr<std::unique_ptr<MappedFile>> mapped =
+      MappedFile::Open(TestFile("does_not_exist"));
+  EXPECT_EQ(mapped.status().code(), absl::StatusCode::kNotFound);
+}
+
+}  // namespace
+}  // namespace gxl
@@ -0,0 +1,175 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gxl/file/memory_file_system.h"
+
+#include <memory>
+#include <string>
+
+#include "absl/hash/hash.h"
+#include "absl/status/status.h"
+#include "absl/strings/match.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/synchronization/mutex.h"
+#include "gxl/file/path.h"
+
+namespace gxl {
+namespace {
+
+std::string Normalize(absl::string_view path) {
+  std::string cleaned = CleanPath(path);
+  const size_t start = cleaned.find_first_not_of('/');
+  cleaned.erase(0, start == std::string::npos ? cleaned.size() : start);
+  return cleaned;
+}
+
+absl::Status DoesNotExistError(absl::string_view path) {
+  return absl::Status(absl::StatusCode::kNotFound,
+                      absl::StrCat("'", path, "' does not exist"));
+}
+
+absl::Status IsDirectoryError(absl::string_view path) {
+  return absl::Status(absl::StatusCode::kFailedPrecondition,
+                      absl::StrCat("'", path, "' is a directory"));
+}
+
+}  // namespace
+
+MemoryFileSystem::Shard& MemoryFileSystem::ShardFor(
+    absl::string_view normalized_path) {
+  return shards_[absl::Hash<absl::string_view>()(normalized_path) %
+                 kNumShards];
+}
+
+absl::Status MemoryFileSystem::DeleteDirectory(
+    absl::string_view normalized_path, absl::string_view path) {
+  for (Shard& shard : shards_) {
+    shard.mu.Lock();
+  }
+  absl::Status status = [&]() -> absl::Status {
+    // The entry may have changed since the caller looked at it.
+    Shard& shard = ShardFor(normalized_path);
+    const auto it = shard.entries.find(normalized_path);
+    if (it == shard.entries.end()) {
+      return DoesNotExistError(path);
+    }
+    if (it->second.contents == nullptr) {
+      const std::string prefix = absl::StrCat(normalized_path, "/");
+      for (const Shard& other : shards_) {
+        for (const auto& [name, entry] : other.entries) {
+          if (absl::StartsWith(name, prefix)) {
+            return absl::Status(
+                absl::StatusCode::kFailedPrecondition,
+                absl::StrCat("Directory '", path, "' is not empty"));
+          }
+        }
+      }
+    }
+    shard.entries.erase(it);
+    return absl::OkStatus();
+  }();
+  for (auto it = shards_.rbegin(); it != shards_.rend(); ++it) {
+    it->mu.Unlock();
+  }
+  return status;
+}
+
+absl::Status MemoryFileSystem::GetContents(absl::string_view path,
+                                           std::string* output) {
+  const std::string name = Normalize(path);
+  std::shared_ptr<const std::string> contents;
+  {
+    Shard& shard = ShardFor(name);
+    absl::MutexLock lock(&shard.mu);
+    const auto it = shard.entries.find(name);
+    if (it == shard.entries.end()) {
+      return DoesNotExistError(path);
+    }
+    contents = it->second.contents;
+  }
+  if (contents == nullptr) {
+    return IsDirectoryError(path);
+  }
+  output->assign(*contents);
+  return absl::OkStatus();
+}
+
+absl::Status MemoryFileSystem::SetContents(absl::string_view path,
+                                           absl::string_view contents) {
+  const std::string name = Normalize(path);
+  if (name.empty()) {
+    return IsDirectoryError(path);
+  }
+  // Copied before taking the lock, and the old contents released after.
+  auto new_contents = std::make_shared<const std::string>(contents);
+  Shard& shard = ShardFor(name);
+  absl::MutexLock lock(&shard.mu);
+  const auto [it, inserted] = shard.entries.try_emplace(name);
+  if (!inserted && it->second.contents == nullptr) {
+    return IsDirectoryError(path);
+  }
+  it->second.contents.swap(new_contents);
+  return absl::OkStatus();
+}
+
+absl::Status MemoryFileSystem::Exists(absl::string_view path) {
+  const std::string name = Normalize(path);
+  if (name.empty()) {
+    return absl::OkStatus();  // The root.
+  }
+  Shard& shard = ShardFor(name);
+  absl::MutexLock lock(&shard.mu);
+  return shard.entries.contains(name) ? absl::OkStatus()
+                                      : DoesNotExistError(path);
+}
+
+absl::Status MemoryFileSystem::Delete(absl::string_view path) {
+  const std::string name = Normalize(path);
+  {
+    Shard& shard = ShardFor(name);
+    absl::MutexLock lock(&shard.mu);
+    const auto it = shard.entries.find(name);
+    if (it == shard.entries.end()) {
+      return DoesNotExistError(path);
+    }
+    if (it->second.contents != nullptr) {
+      shard.entries.erase(it);
+      return absl::OkStatus();
+    }
+  }
+  return DeleteDirectory(name, path);
+}
+
+absl::Status MemoryFileSystem::RecursivelyCreateDir(absl::string_view path) {
+  const std::string name = Normalize(path);
+  for (size_t end = 0; end != std::string::npos;) {
+    end = name.find('/', end + 1);
+    const absl::string_view dir = absl::string_view(name).substr(0, end);
+    if (dir.empty()) {
+      break;
+    }
+    Shard& shard = ShardFor(dir);
+    absl::MutexLock lock(&shard.mu);
+    const auto [it, inserted] = shard.entries.try_emplace(dir);
+    if (!inserted && it->second.contents != nullptr) {
+      return absl::Status(
+          absl::StatusCode::kFailedPrecondition,
+          absl::StrCat("Could not create directory '", path, "': '", dir,
+                       "' is a file"));
+    }
+  }
+  return absl::OkStatus();
+}
+
+}  // namespace gxl
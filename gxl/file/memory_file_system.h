@@ -0,0 +1,83 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GXL_FILE_MEMORY_FILE_SYSTEM_H_
+#define GXL_FILE_MEMORY_FILE_SYSTEM_H_
+
+#include <array>
+#include <memory>
+#include <string>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "absl/synchronization/mutex.h"
+#include "gxl/file/vfs.h"
+
+namespace gxl {
+
+// A file system held in memory, for tests and for data that need not reach
+// the disk.
+//
+// Paths are cleaned with CleanPath() and leading '/'s are ignored, so
+// "mem://a//b" and "mem:///a/b" name the same file. Directories only matter
+// to Exists() and Delete(): files may be created in directories that were
+// never created.
+//
+// The entries are spread over independently locked shards, so threads
+// working on different files rarely contend. Contents are shared between the
+// file system and readers, so a reader copies a file outside of any lock.
+class MemoryFileSystem : public FileSystem {
+ public:
+  MemoryFileSystem() = default;
+
+  MemoryFileSystem(const MemoryFileSystem&) = delete;
+  MemoryFileSystem& operator=(const MemoryFileSystem&) = delete;
+
+  absl::Status GetContents(absl::string_view path,
+                           std::string* output) override;
+  absl::Status SetContents(absl::string_view path,
+                           absl::string_view contents) override;
+  absl::Status Exists(absl::string_view path) override;
+  absl::Status Delete(absl::string_view path) override;
+  absl::Status RecursivelyCreateDir(absl::string_view path) override;
+
+ private:
+  static constexpr int kNumShards = 16;
+
+  struct Entry {
+    // Null for directories.
+    std::shared_ptr<const std::string> contents;
+  };
+
+  struct Shard {
+    absl::Mutex mu;
+    absl::flat_hash_map<std::string, Entry> entries ABSL_GUARDED_BY(mu);
+  };
+
+  Shard& ShardFor(absl::string_view normalized_path);
+
+  // Deletes the directory "normalized_path" if nothing is below it. Holds
+  // every shard lock, taken in order, so that no file can be created in the
+  // directory between the check and the deletion.
+  absl::Status DeleteDirectory(absl::string_view normalized_path,
+                               absl::string_view path)
+      ABSL_NO_THREAD_SAFETY_ANALYSIS;
+
+  std::array<Shard, kNumShards> shards_;
+};
+
+}  // namespace gxl
+
+#endif  // GXL_FILE_MEMORY_FILE_SYSTEM_H_
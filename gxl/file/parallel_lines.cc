@@ -0,0 +1,134 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gxl/file/parallel_lines.h"
+
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include "absl/functional/function_ref.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "gxl/file/file.h"
+#include "gxl/file/filelineiter.h"
+#include "gxl/file/internal/thread_pool.h"
+#include "gxl/file/mapped_file.h"
+#include "gxl/status/status_macros.h"
+
+namespace gxl {
+namespace {
+
+class LineProcessor {
+ public:
+  LineProcessor(absl::string_view contents, const ParallelLinesOptions& options,
+                absl::FunctionRef<absl::Status(absl::string_view)> fn)
+      : contents_(contents),
+        chunk_size_(std::max<size_t>(options.chunk_size, 1)),
+        num_chunks_((contents.size() + chunk_size_ - 1) / chunk_size_),
+        line_options_(options.line_options),
+        fn_(fn) {}
+
+  size_t num_chunks() const { return num_chunks_; }
+
+  // A chunk owns the lines that start within its nominal byte range.
+  absl::Status ProcessChunk(size_t chunk) const {
+    std::string scratch;
+    const char* const data = contents_.data();
+    const size_t end = std::min(contents_.size(), (chunk + 1) * chunk_size_);
+    size_t pos = chunk * chunk_size_;
+    if (pos > 0 && data[pos - 1] != '\n') {
+      // Skip the tail of a line owned by the previous chunk.
+      const void* eol = memchr(data + pos, '\n', contents_.size() - pos);
+      if (eol == nullptr) {
+        return absl::OkStatus();
+      }
+      pos = static_cast<const char*>(eol) - data + 1;
+    }
+    while (pos < end) {
+      const void* eol = memchr(data + pos, '\n', contents_.size() - pos);
+      const size_t next = eol == nullptr
+                              ? contents_.size()
+                              : static_cast<const char*>(eol) - data + 1;
+      RETURN_IF_ERROR(
+          ProcessLine(absl::string_view(data + pos, next - pos), &scratch));
+      pos = next;
+    }
+    return absl::OkStatus();
+  }
+
+ private:
+  bool HasOption(int option) const { return line_options_ & option; }
+
+  // Applies the FileLineIterator options to "line", which includes its '\n'
+  // if any, like FileLineViews does.
+  absl::Status ProcessLine(absl::string_view line, std::string* scratch) const {
+    if (HasOption(FileLineIterator::REMOVE_INLINE_CR) &&
+        line.find('\r') != absl::string_view::npos) {
+      // The mapping is read-only, so drop the '\r's in a copy.
+      scratch->assign(line.data(), line.size());
+      scratch->erase(std::remove(scratch->begin(), scratch->end(), '\r'),
+                     scratch->end());
+      line = *scratch;
+    }
+    if (!HasOption(FileLineIterator::KEEP_LINEFEED) && !line.empty() &&
+        line.back() == '\n') {
+      line.remove_suffix(1);
+    }
+    if (HasOption(FileLineIterator::REMOVE_BLANK_LINES) &&
+        (line.empty() || line == "\n")) {
+      return absl::OkStatus();
+    }
+    return fn_(line);
+  }
+
+  const absl::string_view contents_;
+  const size_t chunk_size_;
+  const size_t num_chunks_;
+  const int line_options_;
+  const absl::FunctionRef<absl::Status(absl::string_view)> fn_;
+};
+
+}  // namespace
+
+absl::Status ParallelForEachLine(
+    absl::string_view filename, const ParallelLinesOptions& options,
+    absl::FunctionRef<absl::Status(absl::string_view line)> fn) {
+  // Checks the type without opening the file: a pipe can only be read once,
+  // so MappedFile::Open() must not consume it.
+  struct stat st;
+  if (stat(std::string(filename).c_str(), &st) == 0 && !S_ISREG(st.st_mode)) {
+    // Not a regular file: fall back to a sequential read.
+    File* file = nullptr;
+    RETURN_IF_ERROR(Open(filename, "r", &file, file::Defaults()));
+    FileLineViews lines(filename, file, options.line_options);
+    for (absl::string_view line : lines) {
+      RETURN_IF_ERROR(fn(line));
+    }
+    return lines.status();
+  }
+  absl::StatusOr<std::unique_ptr<MappedFile>> mapped =
+      MappedFile::Open(filename, MappedFile::Access::kSequential);
+  RETURN_IF_ERROR(mapped.status());
+
+  const LineProcessor processor((*mapped)->contents(), options, fn);
+  return internal::ParallelFor(
+      processor.num_chunks(), options.num_threads,
+      [&processor](size_t chunk) { return processor.ProcessChunk(chunk); });
+}
+
+}  // namespace gxl
@@ -0,0 +1,66 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GXL_FILE_PARALLEL_LINES_H_
+#define GXL_FILE_PARALLEL_LINES_H_
+
+#include <cstddef>
+
+#include "absl/functional/function_ref.h"
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "gxl/file/filelineiter.h"
+
+namespace gxl {
+
+struct ParallelLinesOptions {
+  // FileLineIterator options, with the same meaning as for FileLines.
+  int line_options = FileLineIterator::DEFAULT;
+
+  // Number of worker threads. 0 means one per CPU.
+  int num_threads = 0;
+
+  // Approximate number of bytes handed to a worker at a time. Workers take
+  // chunks from a shared queue, so smaller chunks balance uneven lines better
+  // at the cost of more scheduling.
+  size_t chunk_size = 8 << 20;
+};
+
+// Calls "fn" on every line of "filename", from several threads at once.
+//
+// The file is memory-mapped and cut into chunks of about
+// options.chunk_size bytes, each extended to the end of its last line. Lines
+// of one chunk are passed to "fn" in file order, but different chunks are
+// processed concurrently and in no particular order, so "fn" must be
+// thread-safe. The line views are only valid during the call.
+//
+// If "fn" returns an error, no further chunks are started and the first
+// error is returned. Files that cannot be mapped, such as pipes, are read
+// sequentially on the calling thread instead.
+//
+// Usage:
+//
+//   std::atomic<int64_t> rows = 0;
+//   RETURN_IF_ERROR(ParallelForEachLine(
+//       filename, {.line_options = FileLineIterator::REMOVE_BLANK_LINES},
+//       [&](absl::string_view line) {
+//         ++rows;
+//         return absl::OkStatus();
+//       }));
+absl::Status ParallelForEachLine(
+    absl::string_view filename, const ParallelLinesOptions& options,
+    absl::FunctionRef<absl::Status(absl::string_view line)> fn);
+
+}  // namespace gxl
+
+#endif  // GXL_FILE_PARALLEL_LINES_H_
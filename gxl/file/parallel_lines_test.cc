@@ -0,0 +1,153 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gxl/file/parallel_lines.h"
+
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>  // NOLINT
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/synchronization/mutex.h"
+#include "gtest/gtest.h"
+#include "gxl/file/file.h"
+#include "gxl/file/filelineiter.h"
+
+namespace gxl {
+namespace {
+
+std::string TestFile(absl::string_view name) {
+  return absl::StrCat(testing::TempDir(), "/", name);
+}
+
+// Returns every line of "filename", sorted since chunks finish in any order.
+std::vector<std::string> ReadLines(absl::string_view filename,
+                                   const ParallelLinesOptions& options,
+                                   absl::Status* status) {
+  absl::Mutex mu;
+  std::vector<std::string> lines;
+  *status = ParallelForEachLine(filename, options, [&](absl::string_view line) {
+    absl::MutexLock lock(&mu);
+    lines.push_back(std::string(line));
+    return absl::OkStatus();
+  });
+  std::sort(lines.begin(), lines.end());
+  return lines;
+}
+
+std::vector<std::string> SortedLines(absl::string_view filename,
+                                     int line_options) {
+  std::vector<std::string> lines;
+  for (const std::string& line : FileLines(filename, line_options)) {
+    lines.push_back(line);
+  }
+  std::sort(lines.begin(), lines.end());
+  return lines;
+}
+
+// Checks ParallelForEachLine against FileLines for chunk sizes that split
+// lines at every possible position.
+void ExpectSameLines(absl::string_view filename, int line_options) {
+  const std::vector<std::string> expected =
+      SortedLines(filename, line_options);
+  for (size_t chunk_size : {1, 2, 3, 5, 7, 64, 8 << 20}) {
+    ParallelLinesOptions options;
+    options.line_options = line_options;
+    options.num_threads = 4;
+    options.chunk_size = chunk_size;
+    absl::Status status;
+    EXPECT_EQ(ReadLines(filename, options, &status), expected)
+        << "chunk_size: " << chunk_size;
+    EXPECT_TRUE(status.ok()) << status;
+  }
+}
+
+TEST(ParallelForEachLineTest, ChunksSplitLines) {
+  const std::string filename = TestFile("parallel_lines");
+  ASSERT_TRUE(SetContents(filename, "a\nbb\n\nccc\ndddd\r\ne\n",
+                          file::Defaults())
+                  .ok());
+  ExpectSameLines(filename, FileLineIterator::DEFAULT);
+  ExpectSameLines(filename, FileLineIterator::KEEP_LINEFEED);
+  ExpectSameLines(filename, FileLineIterator::REMOVE_INLINE_CR |
+                                FileLineIterator::REMOVE_BLANK_LINES);
+  ExpectSameLines(filename, FileLineIterator::KEEP_LINEFEED |
+                                FileLineIterator::REMOVE_BLANK_LINES);
+}
+
+TEST(ParallelForEachLineTest, LastLineWithoutLinefeed) {
+  const std::string filename = TestFile("parallel_lines_last_line");
+  ASSERT_TRUE(SetContents(filename, "a\nbb\nccc", file::Defaults()).ok());
+  ExpectSameLines(filename, FileLineIterator::DEFAULT);
+  ExpectSameLines(filename, FileLineIterator::KEEP_LINEFEED);
+}
+
+TEST(ParallelForEachLineTest, EmptyFile) {
+  const std::string filename = TestFile("parallel_lines_empty");
+  ASSERT_TRUE(SetContents(filename, "", file::Defaults()).ok());
+  absl::Status status;
+  EXPECT_TRUE(ReadLines(filename, {}, &status).empty());
+  EXPECT_TRUE(status.ok()) << status;
+}
+
+TEST(ParallelForEachLineTest, MissingFile) {
+  absl::Status status;
+  ReadLines(TestFile("parallel_lines_missing"), {}, &status);
+  EXPECT_FALSE(status.ok());
+}
+
+TEST(ParallelForEachLineTest, ReadsPipesSequentially) {
+  const std::string filename = TestFile("parallel_lines_fifo");
+  unlink(filename.c_str());
+  ASSERT_EQ(mkfifo(filename.c_str(), 0600), 0);
+  std::thread writer([&filename] {
+    EXPECT_TRUE(SetContents(filename, "a\nbb\nccc", file::Defaults()).ok());
+  });
+  absl::Status status;
+  EXPECT_EQ(ReadLines(filename, {.chunk_size = 1}, &status),
+            (std::vector<std::string>{"a", "bb", "ccc"}));
+  EXPECT_TRUE(status.ok()) << status;
+  writer.join();
+}
+
+TEST(ParallelForEachLineTest, ReturnsFirstError) {
+  const std::string filename = TestFile("parallel_lines_error");
+  std::string contents;
+  for (int i = 0; i < 1000; ++i) {
+    absl::StrAppend(&contents, i, "\n");
+  }
+  ASSERT_TRUE(SetContents(filename, contents, file::Defaults()).ok());
+  std::atomic<int> num_calls = 0;
+  const absl::Status status = ParallelForEachLine(
+      filename, {.num_threads = 4, .chunk_size = 16},
+      [&num_calls](absl::string_view line) {
+        ++num_calls;
+        if (line == "500") {
+          return absl::DataLossError("bad line");
+        }
+        return absl::OkStatus();
+      });
+  EXPECT_EQ(status, absl::DataLossError("bad line"));
+  // No chunk starts after the error, so the remaining lines are skipped
+  // except for those of chunks already in progress.
+  EXPECT_LT(num_calls, 1000);
+}
+
+}  // namespace
+}  // namespace gxl
@@ -0,0 +1,118 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gxl/file/proto_stream.h"
+
+#include <cstdint>
+
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "google/protobuf/message_lite.h"
+#include "google/protobuf/util/delimited_message_util.h"
+#include "gxl/file/file.h"
+
+namespace gxl {
+
+int FileInputStream::CopyingFileInputStream::Read(void* buffer, int size) {
+  const size_t n = file_->Read(buffer, size);
+  if (n == 0 && file_->HasError()) {
+    return -1;
+  }
+  return static_cast<int>(n);
+}
+
+FileInputStream::FileInputStream(File* file, int block_size)
+    : copying_input_(file), impl_(&copying_input_, block_size) {}
+
+bool FileInputStream::Next(const void** data, int* size) {
+  return impl_.Next(data, size);
+}
+
+void FileInputStream::BackUp(int count) { impl_.BackUp(count); }
+
+bool FileInputStream::Skip(int count) { return impl_.Skip(count); }
+
+int64_t FileInputStream::ByteCount() const { return impl_.ByteCount(); }
+
+bool FileOutputStream::CopyingFileOutputStream::Write(const void* buffer,
+                                                      int size) {
+  return file_->Write(buffer, size) == static_cast<size_t>(size);
+}
+
+FileOutputStream::FileOutputStream(File* file, int block_size)
+    : copying_output_(file), impl_(&copying_output_, block_size) {}
+
+FileOutputStream::~FileOutputStream() { impl_.Flush(); }
+
+bool FileOutputStream::Flush() {
+  const bool ok = impl_.Flush();
+  return copying_output_.Flush() && ok;
+}
+
+bool FileOutputStream::Next(void** data, int* size) {
+  return impl_.Next(data, size);
+}
+
+void FileOutputStream::BackUp(int count) { impl_.BackUp(count); }
+
+int64_t FileOutputStream::ByteCount() const { return impl_.ByteCount(); }
+
+DelimitedProtoWriter::DelimitedProtoWriter(File* file) : stream_(file) {}
+
+absl::Status DelimitedProtoWriter::Write(
+    const google::protobuf::MessageLite& message) {
+  if (!google::protobuf::util::SerializeDelimitedToZeroCopyStream(message,
+                                                                 &stream_)) {
+    return absl::Status(
+        absl::StatusCode::kInvalidArgument,
+        absl::StrCat("Could not write ", message.GetTypeName()));
+  }
+  return absl::OkStatus();
+}
+
+absl::Status DelimitedProtoWriter::Flush() {
+  if (!stream_.Flush()) {
+    return absl::Status(absl::StatusCode::kInvalidArgument,
+                        "Could not flush delimited messages");
+  }
+  return absl::OkStatus();
+}
+
+DelimitedProtoReader::DelimitedProtoReader(File* file)
+    : file_(file), stream_(file) {}
+
+bool DelimitedProtoReader::Read(google::protobuf::MessageLite* message) {
+  if (!status_.ok()) {
+    return false;
+  }
+  // The parse merges into "message".
+  message->Clear();
+  bool clean_eof = false;
+  if (google::protobuf::util::ParseDelimitedFromZeroCopyStream(
+          message, &stream_, &clean_eof)) {
+    return true;
+  }
+  if (file_->HasError()) {
+    status_ = absl::Status(
+        absl::StatusCode::kUnavailable,
+        absl::StrCat("Could not read '", file_->filename(), "'"));
+  } else if (!clean_eof) {
+    status_ = absl::Status(
+        absl::StatusCode::kDataLoss,
+        absl::StrCat("Could not parse ", message->GetTypeName(),
+                     " at offset ", stream_.ByteCount()));
+  }
+  return false;
+}
+
+}  // namespace gxl
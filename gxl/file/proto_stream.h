@@ -0,0 +1,169 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Streaming protobuf I/O over gxl::File.
+//
+// FileInputStream and FileOutputStream adapt a File to the protobuf
+// zero-copy stream interfaces, so messages can be parsed from or serialized
+// to a file through a fixed-size buffer instead of a std::string holding the
+// whole file. DelimitedProtoReader and DelimitedProtoWriter use them to
+// store a sequence of messages in one file, each prefixed by its varint size.
+
+#ifndef GXL_FILE_PROTO_STREAM_H_
+#define GXL_FILE_PROTO_STREAM_H_
+
+#include <cstdint>
+
+#include "absl/status/status.h"
+#include "google/protobuf/io/zero_copy_stream.h"
+#include "google/protobuf/io/zero_copy_stream_impl_lite.h"
+#include "google/protobuf/message_lite.h"
+#include "gxl/file/file.h"
+
+namespace gxl {
+
+// Reads a File through the ZeroCopyInputStream interface. Does not take
+// ownership of the File, which must outlive the stream.
+class FileInputStream : public google::protobuf::io::ZeroCopyInputStream {
+ public:
+  // A "block_size" of -1 picks a default buffer size.
+  explicit FileInputStream(File* file, int block_size = -1);
+
+  FileInputStream(const FileInputStream&) = delete;
+  FileInputStream& operator=(const FileInputStream&) = delete;
+
+  bool Next(const void** data, int* size) override;
+  void BackUp(int count) override;
+  bool Skip(int count) override;
+  int64_t ByteCount() const override;
+
+ private:
+  class CopyingFileInputStream
+      : public google::protobuf::io::CopyingInputStream {
+   public:
+    explicit CopyingFileInputStream(File* file) : file_(file) {}
+    int Read(void* buffer, int size) override;
+
+   private:
+    File* const file_;
+  };
+
+  CopyingFileInputStream copying_input_;
+  google::protobuf::io::CopyingInputStreamAdaptor impl_;
+};
+
+// Writes a File through the ZeroCopyOutputStream interface. Does not take
+// ownership of the File, which must outlive the stream. Buffered data is
+// written on Flush() and on destruction.
+class FileOutputStream : public google::protobuf::io::ZeroCopyOutputStream {
+ public:
+  // A "block_size" of -1 picks a default buffer size.
+  explicit FileOutputStream(File* file, int block_size = -1);
+
+  FileOutputStream(const FileOutputStream&) = delete;
+  FileOutputStream& operator=(const FileOutputStream&) = delete;
+
+  ~FileOutputStream() override;
+
+  // Writes buffered data to the File and flushes it.
+  bool Flush();
+
+  bool Next(void** data, int* size) override;
+  void BackUp(int count) override;
+  int64_t ByteCount() const override;
+
+ private:
+  class CopyingFileOutputStream
+      : public google::protobuf::io::CopyingOutputStream {
+   public:
+    explicit CopyingFileOutputStream(File* file) : file_(file) {}
+    bool Write(const void* buffer, int size) override;
+    bool Flush() { return file_->Flush(); }
+
+   private:
+    File* const file_;
+  };
+
+  CopyingFileOutputStream copying_output_;
+  google::protobuf::io::CopyingOutputStreamAdaptor impl_;
+};
+
+// Writes messages to a File, each prefixed by its size as a varint. The
+// format is the one of MessageLite::SerializeDelimitedTo*() and Java's
+// writeDelimitedTo().
+//
+// Usage:
+//
+//   File* file;
+//   RETURN_IF_ERROR(Open(filename, "w", &file, file::Defaults()));
+//   {
+//     DelimitedProtoWriter writer(file);
+//     for (const MyProto& proto : protos) {
+//       RETURN_IF_ERROR(writer.Write(proto));
+//     }
+//     RETURN_IF_ERROR(writer.Flush());
+//   }
+//   RETURN_IF_ERROR(file->Close(file::Defaults()));
+class DelimitedProtoWriter {
+ public:
+  // Does not take ownership of "file".
+  explicit DelimitedProtoWriter(File* file);
+
+  DelimitedProtoWriter(const DelimitedProtoWriter&) = delete;
+  DelimitedProtoWriter& operator=(const DelimitedProtoWriter&) = delete;
+
+  absl::Status Write(const google::protobuf::MessageLite& message);
+
+  // Writes buffered messages to the File and flushes it.
+  absl::Status Flush();
+
+ private:
+  FileOutputStream stream_;
+};
+
+// Reads messages written by DelimitedProtoWriter, holding at most one
+// message and one buffer in memory at a time.
+//
+// Usage:
+//
+//   DelimitedProtoReader reader(file);
+//   MyProto proto;
+//   while (reader.Read(&proto)) {
+//     ...
+//   }
+//   RETURN_IF_ERROR(reader.status());
+class DelimitedProtoReader {
+ public:
+  // Does not take ownership of "file".
+  explicit DelimitedProtoReader(File* file);
+
+  DelimitedProtoReader(const DelimitedProtoReader&) = delete;
+  DelimitedProtoReader& operator=(const DelimitedProtoReader&) = delete;
+
+  // Reads the next message into "message". Returns false at the end of the
+  // file or on error; see status().
+  bool Read(google::protobuf::MessageLite* message);
+
+  // kDataLoss if the file ended in the middle of a message or held a
+  // malformed one, kUnavailable if reading the file failed.
+  absl::Status status() const { return status_; }
+
+ private:
+  File* const file_;
+  FileInputStream stream_;
+  absl::Status status_;
+};
+
+}  // namespace gxl
+
+#endif  // GXL_FILE_PROTO_STREAM_H_
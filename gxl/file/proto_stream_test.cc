@@ -0,0 +1,228 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gxl/file/proto_stream.h"
+
+#include <cstring>
+#include <string>
+
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "google/protobuf/descriptor.pb.h"
+#include "google/protobuf/io/zero_copy_stream_impl_lite.h"
+#include "google/protobuf/util/delimited_message_util.h"
+#include "gtest/gtest.h"
+#include "gxl/file/file.h"
+
+namespace gxl {
+namespace {
+
+using ::google::protobuf::FileDescriptorProto;
+
+std::string TestFile(absl::string_view name) {
+  return absl::StrCat(testing::TempDir(), "/", name);
+}
+
+FileDescriptorProto TestProto(int i) {
+  FileDescriptorProto proto;
+  proto.set_name(absl::StrCat("file", i, ".proto"));
+  proto.set_package(std::string(i * 10, 'p'));
+  for (int j = 0; j < i % 5; ++j) {
+    proto.add_dependency(absl::StrCat("dep", j));
+  }
+  return proto;
+}
+
+TEST(FileStreamTest, RoundTripThroughSmallBuffers) {
+  const std::string filename = TestFile("file_stream");
+  const FileDescriptorProto proto = TestProto(100);
+  File* file = File::Open(filename, "w");
+  ASSERT_NE(file, nullptr);
+  {
+    FileOutputStream output(file, /*block_size=*/16);
+    ASSERT_TRUE(proto.SerializeToZeroCopyStream(&output));
+    EXPECT_EQ(output.ByteCount(), proto.ByteSizeLong());
+    ASSERT_TRUE(output.Flush());
+  }
+  ASSERT_TRUE(file->Close(file::Defaults()).ok());
+
+  file = File::Open(filename, "r");
+  ASSERT_NE(file, nullptr);
+  {
+    FileInputStream input(file, /*block_size=*/16);
+    FileDescriptorProto read;
+    ASSERT_TRUE(read.ParseFromZeroCopyStream(&input));
+    EXPECT_EQ(read.SerializeAsString(), proto.SerializeAsString());
+    EXPECT_EQ(input.ByteCount(), proto.ByteSizeLong());
+  }
+  ASSERT_TRUE(file->Close(file::Defaults()).ok());
+}
+
+TEST(FileStreamTest, FlushReachesTheFile) {
+  const std::string filename = TestFile("file_stream_flush");
+  File* file = File::Open(filename, "w");
+  ASSERT_NE(file, nullptr);
+  FileOutputStream output(file);
+  void* data;
+  int size;
+  ASSERT_TRUE(output.Next(&data, &size));
+  ASSERT_GE(size, 5);
+  memcpy(data, "hello", 5);
+  output.BackUp(size - 5);
+  ASSERT_TRUE(output.Flush());
+  // Visible to another reader before the File is closed.
+  std::string contents;
+  ASSERT_TRUE(GetContents(filename, &contents, file::Defaults()).ok());
+  EXPECT_EQ(contents, "hello");
+  ASSERT_TRUE(file->Close(file::Defaults()).ok());
+}
+
+TEST(FileStreamTest, InputSkipAndBackUp) {
+  const std::string filename = TestFile("file_stream_skip");
+  ASSERT_TRUE(SetContents(filename, "0123456789abcdef", file::Defaults()).ok());
+  File* file = File::Open(filename, "r");
+  ASSERT_NE(file, nullptr);
+  {
+    FileInputStream input(file, /*block_size=*/4);
+    const void* data;
+    int size;
+    ASSERT_TRUE(input.Next(&data, &size));
+    ASSERT_EQ(size, 4);
+    EXPECT_EQ(absl::string_view(static_cast<const char*>(data), size), "0123");
+    input.BackUp(2);
+    ASSERT_TRUE(input.Skip(5));  // Skips "23456".
+    ASSERT_TRUE(input.Next(&data, &size));
+    ASSERT_GT(size, 0);
+    EXPECT_EQ(static_cast<const char*>(data)[0], '7');
+    EXPECT_EQ(input.ByteCount(), 7 + size);
+    EXPECT_FALSE(input.Skip(100));
+  }
+  ASSERT_TRUE(file->Close(file::Defaults()).ok());
+}
+
+TEST(DelimitedProtoTest, RoundTrip) {
+  const std::string filename = TestFile("delimited");
+  File* file = File::Open(filename, "w");
+  ASSERT_NE(file, nullptr);
+  {
+    DelimitedProtoWriter writer(file);
+    for (int i = 0; i < 200; ++i) {
+      ASSERT_TRUE(writer.Write(TestProto(i)).ok());
+    }
+    ASSERT_TRUE(writer.Flush().ok());
+    // Flush() reaches the file, not only the File's buffer.
+    std::string contents;
+    ASSERT_TRUE(GetContents(filename, &contents, file::Defaults()).ok());
+    EXPECT_EQ(contents.size(), file->Size());
+    EXPECT_GT(contents.size(), 0);
+  }
+  ASSERT_TRUE(file->Close(file::Defaults()).ok());
+
+  file = File::Open(filename, "r");
+  ASSERT_NE(file, nullptr);
+  {
+    DelimitedProtoReader reader(file);
+    FileDescriptorProto proto;
+    int n = 0;
+    while (reader.Read(&proto)) {
+      EXPECT_EQ(proto.SerializeAsString(), TestProto(n).SerializeAsString());
+      ++n;
+    }
+    EXPECT_TRUE(reader.status().ok()) << reader.status();
+    EXPECT_EQ(n, 200);
+  }
+  ASSERT_TRUE(file->Close(file::Defaults()).ok());
+}
+
+TEST(DelimitedProtoTest, EmptyFile) {
+  const std::string filename = TestFile("delimited_empty");
+  ASSERT_TRUE(SetContents(filename, "", file::Defaults()).ok());
+  File* file = File::Open(filename, "r");
+  ASSERT_NE(file, nullptr);
+  {
+    DelimitedProtoReader reader(file);
+    FileDescriptorProto proto;
+    EXPECT_FALSE(reader.Read(&proto));
+    EXPECT_TRUE(reader.status().ok()) << reader.status();
+  }
+  ASSERT_TRUE(file->Close(file::Defaults()).ok());
+}
+
+TEST(DelimitedProtoTest, TruncatedFile) {
+  const std::string filename = TestFile("delimited_truncated");
+  File* file = File::Open(filename, "w");
+  ASSERT_NE(file, nullptr);
+  {
+    DelimitedProtoWriter writer(file);
+    ASSERT_TRUE(writer.Write(TestProto(1)).ok());
+    ASSERT_TRUE(writer.Write(TestProto(2)).ok());
+    ASSERT_TRUE(writer.Flush().ok());
+  }
+  ASSERT_TRUE(file->Close(file::Defaults()).ok());
+  std::string contents;
+  ASSERT_TRUE(GetContents(filename, &contents, file::Defaults()).ok());
+  contents.pop_back();
+  ASSERT_TRUE(SetContents(filename, contents, file::Defaults()).ok());
+
+  file = File::Open(filename, "r");
+  ASSERT_NE(file, nullptr);
+  {
+    DelimitedProtoReader reader(file);
+    FileDescriptorProto proto;
+    EXPECT_TRUE(reader.Read(&proto));
+    EXPECT_FALSE(reader.Read(&proto));
+    EXPECT_EQ(reader.status().code(), absl::StatusCode::kDataLoss);
+    // The error is sticky.
+    EXPECT_FALSE(reader.Read(&proto));
+  }
+  ASSERT_TRUE(file->Close(file::Defaults()).ok());
+}
+
+TEST(DelimitedProtoTest, ReadError) {
+  const std::string filename = TestFile("delimited_truncated.gz");
+  std::string contents;
+  {
+    google::protobuf::io::StringOutputStream output(&contents);
+    for (int i = 0; i < 1000; ++i) {
+      ASSERT_TRUE(google::protobuf::util::SerializeDelimitedToZeroCopyStream(
+          TestProto(i), &output));
+    }
+  }
+  ASSERT_TRUE(SetContents(filename, contents,
+                          file::Defaults() | file::kCompression)
+                  .ok());
+  ASSERT_TRUE(GetContents(filename, &contents, file::Defaults()).ok());
+  contents.resize(contents.size() / 2);
+  ASSERT_TRUE(SetContents(filename, contents, file::Defaults()).ok());
+
+  // Decompressing the truncated stream fails, which is not a clean end of
+  // file even between two messages.
+  File* file = File::OpenCompressed(filename, "r");
+  ASSERT_NE(file, nullptr);
+  {
+    DelimitedProtoReader reader(file);
+    FileDescriptorProto proto;
+    int n = 0;
+    while (reader.Read(&proto)) {
+      ++n;
+    }
+    EXPECT_LT(n, 1000);
+    EXPECT_EQ(reader.status().code(), absl::StatusCode::kUnavailable)
+        << reader.status();
+  }
+  file->Close(file::Defaults()).IgnoreError();
+}
+
+}  // namespace
+}  // namespace gxl
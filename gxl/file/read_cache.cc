@@ -0,0 +1,222 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gxl/file/read_cache.h"
+
+#include <sys/stat.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif  // _WIN32
+
+#include <cerrno>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "absl/hash/hash.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/synchronization/mutex.h"
+
+namespace gxl {
+namespace {
+
+#ifndef _WIN32
+int64_t MtimeNanos(const struct stat& f_stat) {
+#ifdef __APPLE__
+  const struct timespec& mtime = f_stat.st_mtimespec;
+#else
+  const struct timespec& mtime = f_stat.st_mtim;
+#endif  // __APPLE__
+  return int64_t{mtime.tv_sec} * 1000000000 + mtime.tv_nsec;
+}
+#endif  // _WIN32
+
+}  // namespace
+
+FileReadCache::FileReadCache(const Options& options)
+    : max_shard_bytes_(options.max_bytes / kNumShards) {}
+
+FileReadCache& FileReadCache::Default() {
+  static FileReadCache* const cache = new FileReadCache(Options());
+  return *cache;
+}
+
+#ifndef _WIN32
+absl::StatusOr<FileReadCache::FileVersion> FileReadCache::Stat(
+    const std::string& filename) {
+  struct stat f_stat;
+  if (stat(filename.c_str(), &f_stat) != 0) {
+    return absl::ErrnoToStatus(
+        errno, absl::StrCat("Could not stat '", filename, "'"));
+  }
+  return FileVersion{static_cast<uint64_t>(f_stat.st_dev),
+                     static_cast<uint64_t>(f_stat.st_ino),
+                     static_cast<uint64_t>(f_stat.st_size),
+                     MtimeNanos(f_stat)};
+}
+
+absl::StatusOr<std::shared_ptr<const std::string>> FileReadCache::Read(
+    const std::string& filename, FileVersion* version) {
+  const int fd = open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return absl::ErrnoToStatus(
+        errno, absl::StrCat("Could not open '", filename, "'"));
+  }
+  // The version is that of the opened file, which may be newer than the one
+  // stat() saw.
+  struct stat f_stat;
+  if (fstat(fd, &f_stat) != 0) {
+    const int error = errno;
+    close(fd);
+    return absl::ErrnoToStatus(
+        error, absl::StrCat("Could not stat '", filename, "'"));
+  }
+  *version = FileVersion{static_cast<uint64_t>(f_stat.st_dev),
+                         static_cast<uint64_t>(f_stat.st_ino),
+                         static_cast<uint64_t>(f_stat.st_size),
+                         MtimeNanos(f_stat)};
+  auto contents = std::make_shared<std::string>();
+  contents->resize(f_stat.st_size);
+  size_t done = 0;
+  while (true) {
+    // Once the string is full, the end of the file is detected with a small
+    // buffer: growing the string would reallocate it to about twice the size
+    // of the file, for the common case where the file did not grow.
+    char extra[4096];
+    const bool full = done == contents->size();
+    const ssize_t n =
+        full ? read(fd, extra, sizeof(extra))
+             : read(fd, contents->data() + done, contents->size() - done);
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      const int error = errno;
+      close(fd);
+      return absl::ErrnoToStatus(
+          error, absl::StrCat("Could not read from '", filename, "'"));
+    }
+    if (n == 0) {
+      break;
+    }
+    if (full) {
+      contents->append(extra, n);  // The file grew.
+    }
+    done += n;
+  }
+  close(fd);
+  contents->resize(done);
+  if (done != version->size) {
+    version->size = done;
+    version->mtime_nanos = -1;  // Changed while reading: never current.
+  }
+  return contents;
+}
+#else   // _WIN32
+absl::StatusOr<FileReadCache::FileVersion> FileReadCache::Stat(
+    const std::string& filename) {
+  return absl::Status(
+      absl::StatusCode::kUnimplemented,
+      absl::StrCat("Could not stat '", filename,
+                   "': the read cache is not supported on this platform"));
+}
+
+absl::StatusOr<std::shared_ptr<const std::string>> FileReadCache::Read(
+    const std::string& filename, FileVersion* /*version*/) {
+  return Stat(filename).status();
+}
+#endif  // _WIN32
+
+FileReadCache::Shard& FileReadCache::ShardFor(absl::string_view filename) {
+  return shards_[absl::Hash<absl::string_view>()(filename) % kNumShards];
+}
+
+absl::StatusOr<std::shared_ptr<const std::string>> FileReadCache::GetContents(
+    absl::string_view filename) {
+  const std::string name(filename);
+  absl::StatusOr<FileVersion> current = Stat(name);
+  if (!current.ok()) {
+    return current.status();
+  }
+  Shard& shard = ShardFor(name);
+  {
+    absl::MutexLock lock(&shard.mu);
+    const auto it = shard.entries.find(name);
+    if (it != shard.entries.end() && it->second.version == *current) {
+      hits_.fetch_add(1, std::memory_order_relaxed);
+      shard.lru.splice(shard.lru.begin(), shard.lru, it->second.lru_position);
+      return it->second.contents;
+    }
+  }
+  FileVersion version;
+  absl::StatusOr<std::shared_ptr<const std::string>> contents =
+      Read(name, &version);
+  if (!contents.ok()) {
+    return contents.status();
+  }
+  misses_.fetch_add(1, std::memory_order_relaxed);
+  Insert(shard, name, version, *contents);
+  return contents;
+}
+
+void FileReadCache::Insert(Shard& shard, const std::string& filename,
+                           const FileVersion& version,
+                           std::shared_ptr<const std::string> contents) {
+  absl::MutexLock lock(&shard.mu);
+  EraseLocked(shard, filename);
+  if (contents->size() > max_shard_bytes_) {
+    return;
+  }
+  shard.bytes += contents->size();
+  shard.lru.push_front(filename);
+  shard.entries[filename] =
+      Entry{version, std::move(contents), shard.lru.begin()};
+  while (shard.bytes > max_shard_bytes_) {
+    EraseLocked(shard, shard.lru.back());
+  }
+}
+
+void FileReadCache::EraseLocked(Shard& shard, absl::string_view filename) {
+  const auto it = shard.entries.find(filename);
+  if (it == shard.entries.end()) {
+    return;
+  }
+  shard.bytes -= it->second.contents->size();
+  shard.lru.erase(it->second.lru_position);  // May be "filename".
+  shard.entries.erase(it);
+}
+
+void FileReadCache::Clear() {
+  for (Shard& shard : shards_) {
+    absl::MutexLock lock(&shard.mu);
+    shard.entries.clear();
+    shard.lru.clear();
+    shard.bytes = 0;
+  }
+}
+
+size_t FileReadCache::bytes() const {
+  size_t total = 0;
+  for (const Shard& shard : shards_) {
+    absl::MutexLock lock(&shard.mu);
+    total += shard.bytes;
+  }
+  return total;
+}
+
+}  // namespace gxl
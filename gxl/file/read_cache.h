@@ -0,0 +1,137 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GXL_FILE_READ_CACHE_H_
+#define GXL_FILE_READ_CACHE_H_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "absl/synchronization/mutex.h"
+
+namespace gxl {
+
+// A cache of the contents of local files, for files such as configurations
+// that are loaded over and over.
+//
+// An entry is only used while the file's device, inode, size and
+// modification time are those it was read with, so a file replaced by a
+// rename or rewritten is read again. A hit costs one stat() instead of an
+// open(), a read() and a close(), and no copy: the contents are shared,
+// immutable buffers. A file rewritten in place to the same size within the
+// file system's timestamp granularity can go unnoticed.
+//
+// The least recently used entries are evicted to keep the total size within
+// a budget. Entries are spread over independently locked shards, each with
+// an equal part of the budget.
+//
+// Usage:
+//
+//   ASSIGN_OR_RETURN(std::shared_ptr<const std::string> config,
+//                    FileReadCache::Default().GetContents(filename));
+//
+// GetContents(), GetTextProto() and GetBinaryProto() use Default() when
+// given the file::kReadCache option.
+//
+// Thread-safe.
+class FileReadCache {
+ public:
+  struct Options {
+    // Total size of the cached contents. Files larger than a shard's part of
+    // it are read but not cached.
+    size_t max_bytes = 256 << 20;
+  };
+
+  explicit FileReadCache(const Options& options);
+
+  FileReadCache(const FileReadCache&) = delete;
+  FileReadCache& operator=(const FileReadCache&) = delete;
+
+  // The process-wide cache, with default options. Never deleted.
+  static FileReadCache& Default();
+
+  // Returns the contents of "filename", from the cache if it is current.
+  absl::StatusOr<std::shared_ptr<const std::string>> GetContents(
+      absl::string_view filename);
+
+  // Drops every entry. Buffers still referenced elsewhere stay valid.
+  void Clear();
+
+  // Number of GetContents() calls served from the cache, or not. Failed
+  // calls are not counted.
+  int64_t hits() const { return hits_.load(std::memory_order_relaxed); }
+  int64_t misses() const { return misses_.load(std::memory_order_relaxed); }
+
+  // Total size of the cached contents.
+  size_t bytes() const;
+
+ private:
+  static constexpr int kNumShards = 16;
+
+  // What identifies a version of a file.
+  struct FileVersion {
+    uint64_t device = 0;
+    uint64_t inode = 0;
+    uint64_t size = 0;
+    int64_t mtime_nanos = 0;
+
+    bool operator==(const FileVersion& other) const {
+      return device == other.device && inode == other.inode &&
+             size == other.size && mtime_nanos == other.mtime_nanos;
+    }
+  };
+
+  struct Entry {
+    FileVersion version;
+    std::shared_ptr<const std::string> contents;
+    std::list<std::string>::iterator lru_position;
+  };
+
+  struct Shard {
+    mutable absl::Mutex mu;
+    absl::flat_hash_map<std::string, Entry> entries ABSL_GUARDED_BY(mu);
+    std::list<std::string> lru ABSL_GUARDED_BY(mu);  // Most recent first.
+    size_t bytes ABSL_GUARDED_BY(mu) = 0;
+  };
+
+  static absl::StatusOr<FileVersion> Stat(const std::string& filename);
+
+  // Reads "filename" and returns the version of what was read.
+  static absl::StatusOr<std::shared_ptr<const std::string>> Read(
+      const std::string& filename, FileVersion* version);
+
+  Shard& ShardFor(absl::string_view filename);
+  void Insert(Shard& shard, const std::string& filename,
+              const FileVersion& version,
+              std::shared_ptr<const std::string> contents);
+  static void EraseLocked(Shard& shard, absl::string_view filename)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(shard.mu);
+
+  const size_t max_shard_bytes_;
+  std::array<Shard, kNumShards> shards_;
+  std::atomic<int64_t> hits_{0};
+  std::atomic<int64_t> misses_{0};
+};
+
+}  // namespace gxl
+
+#endif  // GXL_FILE_READ_CACHE_H_
@@ -0,0 +1,86 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gxl/file/read_cache.h"
+
+#include <memory>
+#include <string>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "gtest/gtest.h"
+#include "gxl/file/file.h"
+
+namespace gxl {
+namespace {
+
+std::string TestFile(absl::string_view name) {
+  return absl::StrCat(testing::TempDir(), "/", name);
+}
+
+TEST(ReadCacheTest, ServesCurrentContents) {
+  const std::string filename = TestFile("read_cache");
+  ASSERT_TRUE(SetContents(filename, "v1", file::Defaults()).ok());
+  FileReadCache cache({.max_bytes = 1 << 20});
+  absl::StatusOr<std::shared_ptr<const std::string>> first =
+      cache.GetContents(filename);
+  ASSERT_TRUE(first.ok()) << first.status();
+  absl::StatusOr<std::shared_ptr<const std::string>> second =
+      cache.GetContents(filename);
+  ASSERT_TRUE(second.ok()) << second.status();
+  EXPECT_EQ(first->get(), second->get());  // Shared, not copied.
+  EXPECT_EQ(cache.hits(), 1);
+  EXPECT_EQ(cache.misses(), 1);
+  EXPECT_EQ(cache.bytes(), 2);
+
+  // A replaced file is read again; the old buffer stays valid.
+  ASSERT_TRUE(SetContents(filename, "version 2",
+                          file::Defaults() | file::kAtomicWrite |
+                              file::kNoSync)
+                  .ok());
+  absl::StatusOr<std::shared_ptr<const std::string>> third =
+      cache.GetContents(filename);
+  ASSERT_TRUE(third.ok()) << third.status();
+  EXPECT_EQ(**third, "version 2");
+  EXPECT_EQ(**first, "v1");
+  EXPECT_EQ(cache.misses(), 2);
+
+  EXPECT_EQ(cache.GetContents(TestFile("does_not_exist")).status().code(),
+            absl::StatusCode::kNotFound);
+  cache.Clear();
+  EXPECT_EQ(cache.bytes(), 0);
+
+  std::string contents;
+  ASSERT_TRUE(GetContents(filename, &contents,
+                          file::Defaults() | file::kReadCache)
+                  .ok());
+  EXPECT_EQ(contents, "version 2");
+}
+
+TEST(ReadCacheTest, BufferFitsTheFile) {
+  const std::string filename = TestFile("read_cache_large");
+  const std::string data(1 << 20, 'x');
+  ASSERT_TRUE(SetContents(filename, data, file::Defaults()).ok());
+  FileReadCache cache({.max_bytes = 4 << 20});
+  absl::StatusOr<std::shared_ptr<const std::string>> contents =
+      cache.GetContents(filename);
+  ASSERT_TRUE(contents.ok()) << contents.status();
+  EXPECT_EQ(**contents, data);
+  // Detecting the end of the file did not grow the buffer.
+  EXPECT_LT((*contents)->capacity(), data.size() + 4096);
+}
+
+}  // namespace
+}  // namespace gxl
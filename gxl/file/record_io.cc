@@ -0,0 +1,372 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gxl/file/record_io.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+
+#include "absl/crc/crc32c.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "google/protobuf/message_lite.h"
+#include "gxl/base/endian.h"
+#include "gxl/file/file.h"
+#include "gxl/status/status_macros.h"
+
+namespace gxl {
+namespace {
+
+// Random bytes, unlikely to occur in record data.
+constexpr char kSyncMarker[] = {
+    '\x9a', '\x3e', '\xd1', '\x07', '\x5c', '\xe8', '\x42', '\xb6',
+    '\x1f', '\x8d', '\x73', '\xc9', '\x26', '\xf0', '\x5b', '\x84',
+};
+constexpr size_t kSyncMarkerSize = sizeof(kSyncMarker);
+
+// Sync marker, payload size, record count, CRC32C.
+constexpr size_t kPayloadSizeOffset = kSyncMarkerSize;
+constexpr size_t kNumRecordsOffset = kPayloadSizeOffset + 4;
+constexpr size_t kCrcOffset = kNumRecordsOffset + 4;
+constexpr size_t kHeaderSize = kCrcOffset + 4;
+
+constexpr size_t kMaxPayloadSize = std::numeric_limits<uint32_t>::max();
+constexpr size_t kScanChunkSize = 64 << 10;
+
+// The checksum covers the payload size and record count as well as the
+// payload, so that a damaged size cannot send the reader astray.
+uint32_t BlockCrc(const char* header, absl::string_view payload) {
+  const absl::crc32c_t crc = absl::ComputeCrc32c(absl::string_view(
+      header + kPayloadSizeOffset, kCrcOffset - kPayloadSizeOffset));
+  return static_cast<uint32_t>(absl::ExtendCrc32c(crc, payload));
+}
+
+absl::Status ClosedError() {
+  return absl::Status(absl::StatusCode::kFailedPrecondition,
+                      "Record file is closed");
+}
+
+}  // namespace
+
+absl::StatusOr<std::unique_ptr<RecordWriter>> RecordWriter::Open(
+    absl::string_view filename, const Options& options) {
+  File* file;
+  RETURN_IF_ERROR(gxl::Open(filename, "w", &file, file::Defaults()));
+  return std::unique_ptr<RecordWriter>(new RecordWriter(file, options));
+}
+
+RecordWriter::RecordWriter(File* file, const Options& options)
+    : file_(file), options_(options) {
+  block_.reserve(kHeaderSize + options_.block_size);
+  block_.resize(kHeaderSize);
+}
+
+RecordWriter::~RecordWriter() {
+  if (file_ != nullptr) {
+    Close().IgnoreError();
+  }
+}
+
+absl::Status RecordWriter::WriteRecord(absl::string_view record) {
+  ASSIGN_OR_RETURN(char* dest, StartRecord(record.size()));
+  memcpy(dest, record.data(), record.size());
+  return absl::OkStatus();
+}
+
+absl::Status RecordWriter::WriteProto(
+    const google::protobuf::MessageLite& proto) {
+  const size_t size = proto.ByteSizeLong();
+  ASSIGN_OR_RETURN(char* dest, StartRecord(size));
+  // Serializes straight into the block, using the size computed above.
+  proto.SerializeWithCachedSizesToArray(reinterpret_cast<uint8_t*>(dest));
+  return absl::OkStatus();
+}
+
+absl::StatusOr<char*> RecordWriter::StartRecord(size_t size) {
+  if (file_ == nullptr) {
+    return ClosedError();
+  }
+  if (size > kMaxPayloadSize - 4) {
+    return absl::Status(
+        absl::StatusCode::kInvalidArgument,
+        absl::StrCat("Record of ", size, " bytes is too large"));
+  }
+  const size_t payload_size = block_.size() - kHeaderSize;
+  if (num_records_ > 0 &&
+      (payload_size + 4 + size > options_.block_size ||
+       payload_size + 4 + size > kMaxPayloadSize)) {
+    RETURN_IF_ERROR(WriteBlock());
+  }
+  const size_t pos = block_.size();
+  block_.resize(pos + 4 + size);
+  little_endian::Store32(&block_[pos], size);
+  ++num_records_;
+  return &block_[pos + 4];
+}
+
+absl::Status RecordWriter::WriteBlock() {
+  char* header = &block_[0];
+  memcpy(header, kSyncMarker, kSyncMarkerSize);
+  little_endian::Store32(header + kPayloadSizeOffset,
+                         block_.size() - kHeaderSize);
+  little_endian::Store32(header + kNumRecordsOffset, num_records_);
+  little_endian::Store32(
+      header + kCrcOffset,
+      BlockCrc(header, absl::string_view(block_).substr(kHeaderSize)));
+  if (file_->Write(block_.data(), block_.size()) != block_.size()) {
+    return absl::Status(
+        absl::StatusCode::kInvalidArgument,
+        absl::StrCat("Could not write to '", file_->filename(), "'"));
+  }
+  block_.resize(kHeaderSize);
+  num_records_ = 0;
+  return absl::OkStatus();
+}
+
+absl::Status RecordWriter::Flush() {
+  if (file_ == nullptr) {
+    return ClosedError();
+  }
+  if (num_records_ > 0) {
+    RETURN_IF_ERROR(WriteBlock());
+  }
+  if (!file_->Flush()) {
+    return absl::Status(
+        absl::StatusCode::kInvalidArgument,
+        absl::StrCat("Could not flush '", file_->filename(), "'"));
+  }
+  return absl::OkStatus();
+}
+
+absl::Status RecordWriter::Close() {
+  absl::Status status = Flush();
+  if (file_ != nullptr) {
+    status.Update(file_->Close(file::Defaults()));
+    file_ = nullptr;
+  }
+  return status;
+}
+
+absl::StatusOr<std::unique_ptr<RecordReader>> RecordReader::Open(
+    absl::string_view filename, const Options& options) {
+  File* file;
+  RETURN_IF_ERROR(gxl::Open(filename, "r", &file, file::Defaults()));
+  const uint64_t file_size = file->Size();
+  return std::unique_ptr<RecordReader>(
+      new RecordReader(file, file_size, options));
+}
+
+RecordReader::RecordReader(File* file, uint64_t file_size,
+                           const Options& options)
+    : file_(file), file_size_(file_size), options_(options) {
+  Seek(options_.start_offset);
+}
+
+RecordReader::~RecordReader() { file_->Close(file::Defaults()).IgnoreError(); }
+
+void RecordReader::Seek(uint64_t offset) {
+  status_ = absl::OkStatus();
+  payload_.clear();
+  record_pos_ = 0;
+  records_left_ = 0;
+  next_block_offset_ = offset;
+  at_boundary_ = offset == 0;
+}
+
+bool RecordReader::ReadRecord(absl::string_view* record) {
+  if (!status_.ok()) {
+    return false;
+  }
+  while (records_left_ == 0) {
+    if (!ReadNextBlock()) {
+      return false;
+    }
+  }
+  // The block checksum has been verified, so a bad length means the writer
+  // was broken rather than the file damaged.
+  const absl::string_view rest =
+      absl::string_view(payload_).substr(record_pos_);
+  if (rest.size() < 4 ||
+      rest.size() - 4 < little_endian::Load32(rest.data())) {
+    status_ = absl::Status(
+        absl::StatusCode::kDataLoss,
+        absl::StrCat("Malformed record in block at offset ", block_offset_,
+                     " of '", file_->filename(), "'"));
+    records_left_ = 0;
+    return false;
+  }
+  const uint32_t size = little_endian::Load32(rest.data());
+  *record = rest.substr(4, size);
+  record_pos_ += 4 + size;
+  --records_left_;
+  return true;
+}
+
+bool RecordReader::ReadProto(google::protobuf::MessageLite* proto) {
+  absl::string_view record;
+  if (!ReadRecord(&record)) {
+    return false;
+  }
+  if (!proto->ParseFromArray(record.data(), record.size())) {
+    status_ = absl::Status(
+        absl::StatusCode::kDataLoss,
+        absl::StrCat("Could not parse ", proto->GetTypeName(),
+                     " in block at offset ", block_offset_, " of '",
+                     file_->filename(), "'"));
+    return false;
+  }
+  return true;
+}
+
+bool RecordReader::ReadNextBlock() {
+  if (!status_.ok()) {
+    return false;
+  }
+  const uint64_t limit = std::min(options_.end_offset, file_size_);
+  uint64_t scan_from = next_block_offset_;
+  if (at_boundary_ && scan_from < limit) {
+    // Fast path: the next block follows the previous one.
+    absl::StatusOr<uint32_t> num_records = ReadBlockAt(scan_from);
+    if (num_records.ok()) {
+      StartBlock(scan_from, *num_records);
+      return true;
+    }
+    if (!absl::IsDataLoss(num_records.status()) ||
+        !options_.skip_corrupted_blocks) {
+      status_ = num_records.status();
+      return false;
+    }
+    ++scan_from;
+  }
+  while (true) {
+    absl::StatusOr<uint64_t> found = FindSyncMarker(scan_from, limit);
+    if (!found.ok()) {
+      status_ = found.status();
+      return false;
+    }
+    if (*found >= limit) {
+      SkipTo(limit);
+      return false;
+    }
+    absl::StatusOr<uint32_t> num_records = ReadBlockAt(*found);
+    if (num_records.ok()) {
+      if (!SkipTo(*found)) {
+        return false;
+      }
+      StartBlock(*found, *num_records);
+      return true;
+    }
+    if (!absl::IsDataLoss(num_records.status()) ||
+        !options_.skip_corrupted_blocks) {
+      status_ = num_records.status();
+      return false;
+    }
+    scan_from = *found + 1;
+  }
+}
+
+void RecordReader::StartBlock(uint64_t offset, uint32_t num_records) {
+  block_offset_ = offset;
+  next_block_offset_ = offset + kHeaderSize + payload_.size();
+  at_boundary_ = true;
+  records_left_ = num_records;
+  record_pos_ = 0;
+}
+
+bool RecordReader::SkipTo(uint64_t offset) {
+  if (!at_boundary_ || offset <= next_block_offset_) {
+    return true;
+  }
+  if (!options_.skip_corrupted_blocks) {
+    status_ = absl::Status(
+        absl::StatusCode::kDataLoss,
+        absl::StrCat("Corrupted record block at offset ", next_block_offset_,
+                     " of '", file_->filename(), "'"));
+    return false;
+  }
+  skipped_bytes_ += offset - next_block_offset_;
+  return true;
+}
+
+absl::StatusOr<uint32_t> RecordReader::ReadBlockAt(uint64_t offset) {
+  const auto corrupted = [&](absl::string_view what) {
+    return absl::Status(
+        absl::StatusCode::kDataLoss,
+        absl::StrCat(what, " in record block at offset ", offset, " of '",
+                     file_->filename(), "'"));
+  };
+  char header[kHeaderSize];
+  const int64_t n = file_->PRead(offset, header, kHeaderSize);
+  if (n < 0) {
+    return absl::Status(
+        absl::StatusCode::kUnavailable,
+        absl::StrCat("Could not read '", file_->filename(), "'"));
+  }
+  if (static_cast<uint64_t>(n) < kHeaderSize) {
+    return corrupted("Truncated header");
+  }
+  if (memcmp(header, kSyncMarker, kSyncMarkerSize) != 0) {
+    return corrupted("Missing sync marker");
+  }
+  const uint32_t payload_size =
+      little_endian::Load32(header + kPayloadSizeOffset);
+  if (offset + kHeaderSize + payload_size > file_size_) {
+    return corrupted("Truncated payload");
+  }
+  payload_.resize(payload_size);
+  if (file_->PRead(offset + kHeaderSize, &payload_[0], payload_size) !=
+      static_cast<int64_t>(payload_size)) {
+    return absl::Status(
+        absl::StatusCode::kUnavailable,
+        absl::StrCat("Could not read '", file_->filename(), "'"));
+  }
+  if (little_endian::Load32(header + kCrcOffset) !=
+      BlockCrc(header, payload_)) {
+    return corrupted("Checksum mismatch");
+  }
+  return little_endian::Load32(header + kNumRecordsOffset);
+}
+
+absl::StatusOr<uint64_t> RecordReader::FindSyncMarker(uint64_t from,
+                                                      uint64_t limit) {
+  const absl::string_view marker(kSyncMarker, kSyncMarkerSize);
+  scan_buffer_.resize(kScanChunkSize + kSyncMarkerSize - 1);
+  while (from < limit) {
+    // Overlap the chunks so that a marker straddling two of them is found.
+    const size_t size = std::min<uint64_t>(
+        scan_buffer_.size(), limit - from + kSyncMarkerSize - 1);
+    const int64_t n = file_->PRead(from, &scan_buffer_[0], size);
+    if (n < 0) {
+      return absl::Status(
+          absl::StatusCode::kUnavailable,
+          absl::StrCat("Could not read '", file_->filename(), "'"));
+    }
+    const size_t pos = absl::string_view(scan_buffer_.data(), n).find(marker);
+    if (pos != absl::string_view::npos) {
+      return std::min(from + pos, limit);
+    }
+    if (static_cast<uint64_t>(n) < size) {
+      break;  // End of file.
+    }
+    from += kScanChunkSize;
+  }
+  return limit;
+}
+
+}  // namespace gxl
@@ -0,0 +1,191 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// A file format for long sequences of records, such as serialized protos.
+//
+// A record file is a sequence of blocks. Each block starts with a 16-byte
+// sync marker, followed by the little-endian 32-bit payload size, record
+// count and CRC32C of the block, and then the payload: the records of the
+// block, each prefixed by its little-endian 32-bit length.
+//
+// The sync markers let a reader start anywhere in the file and find the next
+// block, which is how a file is split between parallel readers: a reader
+// given the byte range [start, end) reads the blocks that begin in that range.
+// Splitting a file into adjacent ranges therefore reads every record exactly
+// once. The same mechanism lets a reader skip over corrupted regions.
+
+#ifndef GXL_FILE_RECORD_IO_H_
+#define GXL_FILE_RECORD_IO_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "google/protobuf/message_lite.h"
+#include "gxl/file/file.h"
+
+namespace gxl {
+
+// Writes a record file.
+//
+// Usage:
+//
+//   ASSIGN_OR_RETURN(std::unique_ptr<RecordWriter> writer,
+//                    RecordWriter::Open(filename, {}));
+//   for (const MyProto& proto : protos) {
+//     RETURN_IF_ERROR(writer->WriteProto(proto));
+//   }
+//   RETURN_IF_ERROR(writer->Close());
+//
+// Not thread-safe.
+class RecordWriter {
+ public:
+  struct Options {
+    // Records are grouped until a block holds about this many bytes. Larger
+    // blocks cost less space and checksumming per record; smaller blocks lose
+    // less data to a corruption and split a file more finely.
+    size_t block_size = 64 << 10;
+  };
+
+  // Creates or truncates "filename".
+  static absl::StatusOr<std::unique_ptr<RecordWriter>> Open(
+      absl::string_view filename, const Options& options);
+
+  RecordWriter(const RecordWriter&) = delete;
+  RecordWriter& operator=(const RecordWriter&) = delete;
+
+  // Closes the file if Close() was not called, ignoring errors.
+  ~RecordWriter();
+
+  absl::Status WriteRecord(absl::string_view record);
+
+  // Writes the binary serialization of "proto" as one record.
+  absl::Status WriteProto(const google::protobuf::MessageLite& proto);
+
+  // Ends the current block and flushes it to the file, so that readers see
+  // every record written so far.
+  absl::Status Flush();
+
+  // Flushes and closes the file. Later calls fail.
+  absl::Status Close();
+
+ private:
+  RecordWriter(File* file, const Options& options);
+
+  // Starts a record of "size" bytes and returns where to put its contents,
+  // ending the current block first if the record does not fit.
+  absl::StatusOr<char*> StartRecord(size_t size);
+  absl::Status WriteBlock();
+
+  File* file_;
+  const Options options_;
+  std::string block_;  // Header and payload of the current block.
+  uint32_t num_records_ = 0;
+};
+
+// Reads a record file, or the part of it given in Options.
+//
+// Usage:
+//
+//   ASSIGN_OR_RETURN(std::unique_ptr<RecordReader> reader,
+//                    RecordReader::Open(filename, {}));
+//   MyProto proto;
+//   while (reader->ReadProto(&proto)) {
+//     ...
+//   }
+//   RETURN_IF_ERROR(reader->status());
+//
+// Not thread-safe. Parallel readers each open their own RecordReader.
+class RecordReader {
+ public:
+  struct Options {
+    // Read the blocks that start in [start_offset, end_offset). The offsets
+    // need not be block boundaries.
+    uint64_t start_offset = 0;
+    uint64_t end_offset = std::numeric_limits<uint64_t>::max();
+
+    // If true, corrupted or truncated blocks are skipped and counted in
+    // skipped_bytes(). Otherwise reading stops with a kDataLoss error.
+    bool skip_corrupted_blocks = false;
+  };
+
+  static absl::StatusOr<std::unique_ptr<RecordReader>> Open(
+      absl::string_view filename, const Options& options);
+
+  RecordReader(const RecordReader&) = delete;
+  RecordReader& operator=(const RecordReader&) = delete;
+
+  ~RecordReader();
+
+  // Reads the next record. The view is valid until the next call to a
+  // non-const method. Returns false at the end of the range or on error; see
+  // status().
+  bool ReadRecord(absl::string_view* record);
+
+  // Reads the next record and parses it into "proto".
+  bool ReadProto(google::protobuf::MessageLite* proto);
+
+  // Continues reading at the first block that starts at or after "offset".
+  // The end of the range is unchanged. Clears any previous error.
+  void Seek(uint64_t offset);
+
+  // Offset of the block holding the last record read. Seek()ing there later
+  // reads that block again, which makes it usable as a checkpoint.
+  uint64_t block_offset() const { return block_offset_; }
+
+  // Bytes passed over because they were not part of a valid block.
+  uint64_t skipped_bytes() const { return skipped_bytes_; }
+
+  absl::Status status() const { return status_; }
+
+ private:
+  RecordReader(File* file, uint64_t file_size, const Options& options);
+
+  bool ReadNextBlock();
+
+  // Reads and verifies the block at "offset" into payload_. Returns its
+  // record count.
+  absl::StatusOr<uint32_t> ReadBlockAt(uint64_t offset);
+  void StartBlock(uint64_t offset, uint32_t num_records);
+
+  // Returns the offset of the first sync marker that starts in
+  // [from, limit), or "limit" if there is none.
+  absl::StatusOr<uint64_t> FindSyncMarker(uint64_t from, uint64_t limit);
+
+  // Accounts for the bytes between the expected next block and "offset".
+  bool SkipTo(uint64_t offset);
+
+  File* file_;
+  const uint64_t file_size_;
+  const Options options_;
+  absl::Status status_;
+  std::string payload_;
+  size_t record_pos_ = 0;
+  uint32_t records_left_ = 0;
+  uint64_t block_offset_ = 0;
+  uint64_t next_block_offset_ = 0;
+  // True if a block is expected exactly at next_block_offset_, as opposed to
+  // after a Seek() to an arbitrary offset.
+  bool at_boundary_ = false;
+  uint64_t skipped_bytes_ = 0;
+  std::string scan_buffer_;
+};
+
+}  // namespace gxl
+
+#endif  // GXL_FILE_RECORD_IO_H_
@@ -0,0 +1,201 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gxl/file/record_io.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "gtest/gtest.h"
+#include "gxl/file/file.h"
+
+namespace gxl {
+namespace {
+
+std::string TestFile(absl::string_view name) {
+  return absl::StrCat(testing::TempDir(), "/", name);
+}
+
+std::vector<std::string> TestRecords(int n) {
+  std::vector<std::string> records;
+  for (int i = 0; i < n; ++i) {
+    records.push_back(std::string(i % 97, 'a' + i % 26) + absl::StrCat(i));
+  }
+  return records;
+}
+
+void WriteRecords(absl::string_view filename,
+                  const std::vector<std::string>& records, size_t block_size) {
+  absl::StatusOr<std::unique_ptr<RecordWriter>> writer =
+      RecordWriter::Open(filename, {.block_size = block_size});
+  ASSERT_TRUE(writer.ok()) << writer.status();
+  for (const std::string& record : records) {
+    ASSERT_TRUE((*writer)->WriteRecord(record).ok());
+  }
+  ASSERT_TRUE((*writer)->Close().ok());
+}
+
+std::vector<std::string> ReadRecords(absl::string_view filename,
+                                     const RecordReader::Options& options,
+                                     absl::Status* status) {
+  std::vector<std::string> records;
+  absl::StatusOr<std::unique_ptr<RecordReader>> reader =
+      RecordReader::Open(filename, options);
+  if (!reader.ok()) {
+    *status = reader.status();
+    return records;
+  }
+  absl::string_view record;
+  while ((*reader)->ReadRecord(&record)) {
+    records.emplace_back(record);
+  }
+  *status = (*reader)->status();
+  return records;
+}
+
+TEST(RecordIOTest, RoundTrip) {
+  const std::string filename = TestFile("round_trip.rio");
+  const std::vector<std::string> records = TestRecords(1000);
+  WriteRecords(filename, records, 1024);
+  absl::Status status;
+  EXPECT_EQ(ReadRecords(filename, {}, &status), records);
+  EXPECT_TRUE(status.ok()) << status;
+}
+
+TEST(RecordIOTest, EmptyFile) {
+  const std::string filename = TestFile("empty.rio");
+  WriteRecords(filename, {}, 1024);
+  absl::Status status;
+  EXPECT_TRUE(ReadRecords(filename, {}, &status).empty());
+  EXPECT_TRUE(status.ok()) << status;
+}
+
+TEST(RecordIOTest, SplitsReadEveryRecordOnce) {
+  const std::string filename = TestFile("splits.rio");
+  const std::vector<std::string> records = TestRecords(1000);
+  WriteRecords(filename, records, 512);
+  std::string contents;
+  ASSERT_TRUE(GetContents(filename, &contents, file::Defaults()).ok());
+  const uint64_t size = contents.size();
+  for (uint64_t num_splits : {2, 3, 7, 50}) {
+    std::vector<std::string> all;
+    for (uint64_t i = 0; i < num_splits; ++i) {
+      absl::Status status;
+      std::vector<std::string> split =
+          ReadRecords(filename,
+                      {.start_offset = size * i / num_splits,
+                       .end_offset = size * (i + 1) / num_splits},
+                      &status);
+      ASSERT_TRUE(status.ok()) << status;
+      all.insert(all.end(), split.begin(), split.end());
+    }
+    EXPECT_EQ(all, records) << num_splits << " splits";
+  }
+}
+
+TEST(RecordIOTest, SeekToBlockOffset) {
+  const std::string filename = TestFile("seek.rio");
+  const std::vector<std::string> records = TestRecords(100);
+  WriteRecords(filename, records, 256);
+  absl::StatusOr<std::unique_ptr<RecordReader>> reader =
+      RecordReader::Open(filename, {});
+  ASSERT_TRUE(reader.ok());
+  absl::string_view record;
+  for (int i = 0; i < 50; ++i) {
+    ASSERT_TRUE((*reader)->ReadRecord(&record));
+  }
+  const uint64_t checkpoint = (*reader)->block_offset();
+  ASSERT_TRUE((*reader)->ReadRecord(&record));
+  const std::string next(record);
+
+  (*reader)->Seek(checkpoint);
+  bool found = false;
+  while (!found && (*reader)->ReadRecord(&record)) {
+    found = record == next;
+  }
+  EXPECT_TRUE(found);
+}
+
+TEST(RecordIOTest, CorruptedBlock) {
+  const std::string filename = TestFile("corrupted.rio");
+  const std::vector<std::string> records = TestRecords(1000);
+  WriteRecords(filename, records, 1024);
+  File* file = File::OpenOrDie(filename, "r+");
+  const uint64_t size = file->Size();
+  ASSERT_EQ(file->PWrite(size / 2, "XXXX", 4), 4);
+  ASSERT_TRUE(file->Close());
+
+  absl::Status status;
+  std::vector<std::string> read = ReadRecords(filename, {}, &status);
+  EXPECT_EQ(status.code(), absl::StatusCode::kDataLoss);
+  EXPECT_LT(read.size(), records.size());
+
+  absl::StatusOr<std::unique_ptr<RecordReader>> reader =
+      RecordReader::Open(filename, {.skip_corrupted_blocks = true});
+  ASSERT_TRUE(reader.ok());
+  absl::string_view record;
+  int num_read = 0;
+  while ((*reader)->ReadRecord(&record)) {
+    ++num_read;
+  }
+  EXPECT_TRUE((*reader)->status().ok()) << (*reader)->status();
+  EXPECT_LT(num_read, records.size());
+  EXPECT_GT(num_read, records.size() * 9 / 10);
+  EXPECT_GT((*reader)->skipped_bytes(), 0);
+}
+
+TEST(RecordIOTest, TruncatedFile) {
+  const std::string filename = TestFile("truncated.rio");
+  WriteRecords(filename, TestRecords(100), 256);
+  std::string contents;
+  ASSERT_TRUE(GetContents(filename, &contents, file::Defaults()).ok());
+  contents.resize(contents.size() - 10);
+  ASSERT_TRUE(SetContents(filename, contents, file::Defaults()).ok());
+
+  absl::Status status;
+  ReadRecords(filename, {}, &status);
+  EXPECT_EQ(status.code(), absl::StatusCode::kDataLoss);
+  ReadRecords(filename, {.skip_corrupted_blocks = true}, &status);
+  EXPECT_TRUE(status.ok()) << status;
+}
+
+TEST(RecordIOTest, ReadsOnlyTheSizeAtOpen) {
+  const std::string filename = TestFile("growing.rio");
+  WriteRecords(filename, TestRecords(10), 1 << 16);
+  std::string contents;
+  ASSERT_TRUE(GetContents(filename, &contents, file::Defaults()).ok());
+  // Cuts the file inside the header of its only block.
+  ASSERT_TRUE(
+      SetContents(filename, contents.substr(0, 20), file::Defaults()).ok());
+  absl::StatusOr<std::unique_ptr<RecordReader>> reader =
+      RecordReader::Open(filename, {});
+  ASSERT_TRUE(reader.ok()) << reader.status();
+
+  // The rest of the block is appended after the reader took the size.
+  File* file = File::OpenOrDie(filename, "a");
+  ASSERT_EQ(file->Write(contents.data() + 20, contents.size() - 20),
+            contents.size() - 20);
+  ASSERT_TRUE(file->Close());
+  absl::string_view record;
+  EXPECT_FALSE((*reader)->ReadRecord(&record));
+  EXPECT_EQ((*reader)->status().code(), absl::StatusCode::kDataLoss);
+}
+
+}  // namespace
+}  // namespace gxl
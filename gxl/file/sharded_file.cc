@@ -0,0 +1,151 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gxl/file/sharded_file.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/functional/function_ref.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/ascii.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_format.h"
+#include "absl/strings/string_view.h"
+#include "gxl/file/file.h"
+#include "gxl/file/filelineiter.h"
+#include "gxl/file/internal/thread_pool.h"
+#include "gxl/file/path.h"
+#include "gxl/file/record_io.h"
+#include "gxl/file/vfs.h"
+#include "gxl/status/status_macros.h"
+
+namespace gxl {
+namespace {
+
+// Splits "spec" at the '@' of its base name. Returns false if the base name
+// does not end with "@<digits>".
+bool SplitShardedSpec(absl::string_view spec, absl::string_view* name,
+                      absl::string_view* count) {
+  const absl::string_view basename = Basename(spec);
+  const size_t at = basename.rfind('@');
+  if (at == absl::string_view::npos || at + 1 == basename.size()) {
+    return false;
+  }
+  *count = basename.substr(at + 1);
+  if (!std::all_of(count->begin(), count->end(), absl::ascii_isdigit)) {
+    return false;
+  }
+  *name = spec.substr(0, spec.size() - count->size() - 1);
+  return true;
+}
+
+// Calls a per-shard function on every shard, several at a time.
+absl::Status ForEachShard(
+    absl::string_view spec, const ShardReadOptions& options,
+    absl::FunctionRef<absl::Status(int, const std::string&)> fn) {
+  ASSIGN_OR_RETURN(const std::vector<std::string> filenames,
+                   ExpandShardedSpec(spec));
+  return internal::ParallelFor(
+      filenames.size(), options.num_threads,
+      [&filenames, fn](size_t shard) { return fn(shard, filenames[shard]); });
+}
+
+}  // namespace
+
+bool IsShardedSpec(absl::string_view spec) {
+  absl::string_view name, count;
+  return SplitShardedSpec(spec, &name, &count);
+}
+
+absl::StatusOr<ShardedSpec> ParseShardedSpec(absl::string_view spec) {
+  absl::string_view name, count;
+  ShardedSpec parsed;
+  if (!SplitShardedSpec(spec, &name, &count) || Basename(name).empty() ||
+      !absl::SimpleAtoi(count, &parsed.num_shards) || parsed.num_shards == 0) {
+    return absl::Status(
+        absl::StatusCode::kInvalidArgument,
+        absl::StrCat("Invalid sharded file spec '", spec,
+                     "': expected <name>@<number of shards>"));
+  }
+  parsed.name = std::string(name);
+  return parsed;
+}
+
+std::string ShardFilename(absl::string_view name, int shard, int num_shards) {
+  const int width = std::max<int>(5, absl::StrCat(num_shards).size());
+  return JoinPath(Dirname(name),
+                  absl::StrFormat("%s-%0*d-of-%0*d", Basename(name), width,
+                                  shard, width, num_shards));
+}
+
+absl::StatusOr<std::vector<std::string>> ExpandShardedSpec(
+    absl::string_view spec) {
+  if (!IsShardedSpec(spec)) {
+    return std::vector<std::string>{std::string(spec)};
+  }
+  ASSIGN_OR_RETURN(const ShardedSpec parsed, ParseShardedSpec(spec));
+  std::vector<std::string> filenames;
+  filenames.reserve(parsed.num_shards);
+  for (int shard = 0; shard < parsed.num_shards; ++shard) {
+    filenames.push_back(ShardFilename(parsed.name, shard, parsed.num_shards));
+  }
+  return filenames;
+}
+
+absl::Status ForEachShardLine(
+    absl::string_view spec, const ShardReadOptions& options,
+    absl::FunctionRef<absl::Status(int shard, absl::string_view line)> fn) {
+  return ForEachShard(
+      spec, options,
+      [&](int shard, const std::string& filename) -> absl::Status {
+        // Registered file systems have no compressed streams.
+        absl::string_view path;
+        const file::Options open_options =
+            GetFileSystem(filename, &path) != nullptr
+                ? file::Defaults()
+                : file::Defaults() | file::kCompression;
+        File* file = nullptr;
+        RETURN_IF_ERROR(Open(filename, "r", &file, open_options));
+        FileLineViews lines(filename, file, options.line_options);
+        for (absl::string_view line : lines) {
+          RETURN_IF_ERROR(fn(shard, line));
+        }
+        return lines.status();
+      });
+}
+
+absl::Status ForEachShardRecord(
+    absl::string_view spec, const ShardReadOptions& options,
+    absl::FunctionRef<absl::Status(int shard, absl::string_view record)> fn) {
+  return ForEachShard(
+      spec, options,
+      [&](int shard, const std::string& filename) -> absl::Status {
+        RecordReader::Options reader_options;
+        reader_options.skip_corrupted_blocks = options.skip_corrupted_blocks;
+        ASSIGN_OR_RETURN(std::unique_ptr<RecordReader> reader,
+                         RecordReader::Open(filename, reader_options));
+        absl::string_view record;
+        while (reader->ReadRecord(&record)) {
+          RETURN_IF_ERROR(fn(shard, record));
+        }
+        return reader->status();
+      });
+}
+
+}  // namespace gxl
@@ -0,0 +1,97 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Sharded files: a dataset stored as N files named
+// "<name>-<index>-of-<N>", with zero-padded indices, such as
+// "/data/out-00003-of-01024". The spec "/data/out@1024" names all of them.
+
+#ifndef GXL_FILE_SHARDED_FILE_H_
+#define GXL_FILE_SHARDED_FILE_H_
+
+#include <string>
+#include <vector>
+
+#include "absl/functional/function_ref.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "gxl/file/filelineiter.h"
+
+namespace gxl {
+
+// A parsed "<name>@<N>" spec.
+struct ShardedSpec {
+  std::string name;  // The spec without the "@<N>" suffix.
+  int num_shards = 0;
+};
+
+// Returns true if the base name of "spec" ends with "@<N>", where N is a
+// decimal number.
+bool IsShardedSpec(absl::string_view spec);
+
+// Parses a "<name>@<N>" spec. Returns kInvalidArgument if "spec" is not one,
+// if N is 0, or if the name part is empty.
+absl::StatusOr<ShardedSpec> ParseShardedSpec(absl::string_view spec);
+
+// Returns the name of shard "shard" of "num_shards", for example
+// ShardFilename("/data/out", 3, 1024) == "/data/out-00003-of-01024".
+// Indices have five digits, or more if "num_shards" needs them.
+std::string ShardFilename(absl::string_view name, int shard, int num_shards);
+
+// Returns the file names of all shards of "spec", in shard order. A spec
+// without an "@<N>" suffix names a single file, which is returned as is.
+absl::StatusOr<std::vector<std::string>> ExpandShardedSpec(
+    absl::string_view spec);
+
+struct ShardReadOptions {
+  // Number of shards read concurrently. 0 means one per CPU.
+  int num_threads = 0;
+
+  // FileLineIterator options, for ForEachShardLine().
+  int line_options = FileLineIterator::DEFAULT;
+
+  // For ForEachShardRecord(): whether to skip corrupted blocks, as for
+  // RecordReader::Options.
+  bool skip_corrupted_blocks = false;
+};
+
+// Calls "fn" on every line of every shard of "spec", reading several shards
+// at once. Lines of one shard are passed in order, together with the shard
+// index, but shards are processed concurrently and in no particular order, so
+// "fn" must be thread-safe. The line views are only valid during the call.
+//
+// Local shards compressed with gzip or zstd are decompressed, as detected
+// from their contents. Unlike FileLines, a missing shard is an error, and so
+// is a read error or corrupt compressed data. If "fn" returns an error, no
+// further shards are started and the first error is returned.
+//
+// Usage:
+//
+//   std::atomic<int64_t> rows = 0;
+//   RETURN_IF_ERROR(ForEachShardLine(
+//       "/data/out@1024", {}, [&](int shard, absl::string_view line) {
+//         ++rows;
+//         return absl::OkStatus();
+//       }));
+absl::Status ForEachShardLine(
+    absl::string_view spec, const ShardReadOptions& options,
+    absl::FunctionRef<absl::Status(int shard, absl::string_view line)> fn);
+
+// Same as ForEachShardLine(), for shards in the record_io.h format.
+absl::Status ForEachShardRecord(
+    absl::string_view spec, const ShardReadOptions& options,
+    absl::FunctionRef<absl::Status(int shard, absl::string_view record)> fn);
+
+}  // namespace gxl
+
+#endif  // GXL_FILE_SHARDED_FILE_H_
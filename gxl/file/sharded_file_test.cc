@@ -0,0 +1,246 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gxl/file/sharded_file.h"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/synchronization/mutex.h"
+#include "gtest/gtest.h"
+#include "gxl/file/compression.h"
+#include "gxl/file/file.h"
+#include "gxl/file/record_io.h"
+
+namespace gxl {
+namespace {
+
+std::string TestFile(absl::string_view name) {
+  return absl::StrCat(testing::TempDir(), "/", name);
+}
+
+TEST(ShardedFileTest, ShardFilename) {
+  EXPECT_EQ(ShardFilename("/data/out", 3, 1024), "/data/out-00003-of-01024");
+  EXPECT_EQ(ShardFilename("/data/out", 0, 1), "/data/out-00000-of-00001");
+  EXPECT_EQ(ShardFilename("/data/out", 99999, 100000),
+            "/data/out-099999-of-100000");
+  EXPECT_EQ(ShardFilename("/data/out", 7, 1234567),
+            "/data/out-0000007-of-1234567");
+  EXPECT_EQ(ShardFilename("out", 1, 2), "out-00001-of-00002");
+}
+
+TEST(ShardedFileTest, ParseShardedSpec) {
+  EXPECT_TRUE(IsShardedSpec("/data/out@10"));
+  EXPECT_FALSE(IsShardedSpec("/data/out"));
+  EXPECT_FALSE(IsShardedSpec("/data/out@"));
+  EXPECT_FALSE(IsShardedSpec("/data/out@ten"));
+  EXPECT_FALSE(IsShardedSpec("/data@10/out"));
+
+  absl::StatusOr<ShardedSpec> spec = ParseShardedSpec("/data/out@10");
+  ASSERT_TRUE(spec.ok()) << spec.status();
+  EXPECT_EQ(spec->name, "/data/out");
+  EXPECT_EQ(spec->num_shards, 10);
+
+  for (absl::string_view bad :
+       {"/data/out", "/data/out@0", "/data/@10", "@10", "out@99999999999"}) {
+    EXPECT_EQ(ParseShardedSpec(bad).status().code(),
+              absl::StatusCode::kInvalidArgument)
+        << bad;
+  }
+}
+
+TEST(ShardedFileTest, ExpandShardedSpec) {
+  absl::StatusOr<std::vector<std::string>> filenames =
+      ExpandShardedSpec("/data/out@3");
+  ASSERT_TRUE(filenames.ok()) << filenames.status();
+  EXPECT_EQ(*filenames, (std::vector<std::string>{"/data/out-00000-of-00003",
+                                                  "/data/out-00001-of-00003",
+                                                  "/data/out-00002-of-00003"}));
+
+  // Not a spec: a single file.
+  filenames = ExpandShardedSpec("/data/out@ten");
+  ASSERT_TRUE(filenames.ok()) << filenames.status();
+  EXPECT_EQ(*filenames, std::vector<std::string>{"/data/out@ten"});
+
+  EXPECT_EQ(ExpandShardedSpec("/data/out@0").status().code(),
+            absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(ExpandShardedSpec("/data/@3").status().code(),
+            absl::StatusCode::kInvalidArgument);
+}
+
+// Writes "num_shards" shards of lines "<shard>:<line>" and returns the spec.
+std::string WriteLineShards(absl::string_view name, int num_shards,
+                            int num_lines) {
+  const std::string base = TestFile(name);
+  for (int shard = 0; shard < num_shards; ++shard) {
+    std::string contents;
+    for (int line = 0; line < num_lines; ++line) {
+      absl::StrAppend(&contents, shard, ":", line, "\n");
+    }
+    EXPECT_TRUE(SetContents(ShardFilename(base, shard, num_shards), contents,
+                            file::Defaults())
+                    .ok());
+  }
+  return absl::StrCat(base, "@", num_shards);
+}
+
+TEST(ShardedFileTest, ForEachShardLine) {
+  const std::string spec = WriteLineShards("lines", 7, 100);
+  absl::Mutex mu;
+  std::vector<int> next_line(7, 0);
+  const absl::Status status = ForEachShardLine(
+      spec, {.num_threads = 3}, [&](int shard, absl::string_view line) {
+        absl::MutexLock lock(&mu);
+        // Lines of a shard arrive in order.
+        EXPECT_EQ(line, absl::StrCat(shard, ":", next_line[shard]++));
+        return absl::OkStatus();
+      });
+  EXPECT_TRUE(status.ok()) << status;
+  EXPECT_EQ(next_line, std::vector<int>(7, 100));
+}
+
+TEST(ShardedFileTest, ForEachShardRecord) {
+  const std::string base = TestFile("records");
+  for (int shard = 0; shard < 4; ++shard) {
+    absl::StatusOr<std::unique_ptr<RecordWriter>> writer =
+        RecordWriter::Open(ShardFilename(base, shard, 4), {});
+    ASSERT_TRUE(writer.ok()) << writer.status();
+    for (int i = 0; i < 10; ++i) {
+      ASSERT_TRUE((*writer)->WriteRecord(absl::StrCat(shard, ":", i)).ok());
+    }
+    ASSERT_TRUE((*writer)->Close().ok());
+  }
+  absl::Mutex mu;
+  std::set<std::string> records;
+  const absl::Status status =
+      ForEachShardRecord(absl::StrCat(base, "@4"), {},
+                         [&](int shard, absl::string_view record) {
+                           absl::MutexLock lock(&mu);
+                           EXPECT_TRUE(records.emplace(record).second);
+                           return absl::OkStatus();
+                         });
+  EXPECT_TRUE(status.ok()) << status;
+  EXPECT_EQ(records.size(), 40);
+}
+
+TEST(ShardedFileTest, MissingShardIsAnError) {
+  const std::string spec = WriteLineShards("missing_shard", 3, 10);
+  ASSERT_EQ(unlink(ShardFilename(TestFile("missing_shard"), 1, 3).c_str()), 0);
+  EXPECT_FALSE(ForEachShardLine(spec, {}, [](int, absl::string_view) {
+                 return absl::OkStatus();
+               }).ok());
+  EXPECT_FALSE(ForEachShardRecord(spec, {}, [](int, absl::string_view) {
+                 return absl::OkStatus();
+               }).ok());
+}
+
+// Returns the lines "0\n" through "9999\n".
+std::string TenThousandLines() {
+  std::string text;
+  for (int i = 0; i < 10000; ++i) {
+    absl::StrAppend(&text, i, "\n");
+  }
+  return text;
+}
+
+TEST(ShardedFileTest, ForEachShardLineDecompresses) {
+  const std::string text = TenThousandLines();
+  CompressionOptions compression_options;
+  compression_options.compression = Compression::kGzip;
+  std::string compressed;
+  ASSERT_TRUE(Compress(text, compression_options, &compressed).ok());
+  const std::string base = TestFile("compressed_lines");
+  ASSERT_TRUE(SetContents(ShardFilename(base, 0, 2), compressed,
+                          file::Defaults())
+                  .ok());
+  ASSERT_TRUE(
+      SetContents(ShardFilename(base, 1, 2), text, file::Defaults()).ok());
+  std::atomic<int> lines = 0;
+  const absl::Status status = ForEachShardLine(
+      absl::StrCat(base, "@2"), {}, [&](int, absl::string_view) {
+        ++lines;
+        return absl::OkStatus();
+      });
+  EXPECT_TRUE(status.ok()) << status;
+  EXPECT_EQ(lines, 20000);
+}
+
+TEST(ShardedFileTest, TruncatedCompressedShardIsAnError) {
+  CompressionOptions compression_options;
+  compression_options.compression = Compression::kGzip;
+  std::string compressed;
+  ASSERT_TRUE(
+      Compress(TenThousandLines(), compression_options, &compressed).ok());
+  compressed.resize(compressed.size() / 2);
+  const std::string base = TestFile("truncated_lines");
+  ASSERT_TRUE(SetContents(ShardFilename(base, 0, 1), compressed,
+                          file::Defaults())
+                  .ok());
+  std::atomic<int> lines = 0;
+  const absl::Status status = ForEachShardLine(
+      absl::StrCat(base, "@1"), {}, [&](int, absl::string_view) {
+        ++lines;
+        return absl::OkStatus();
+      });
+  EXPECT_FALSE(status.ok());
+  EXPECT_LT(lines, 10000);
+}
+
+TEST(ShardedFileTest, ReturnsFirstError) {
+  const std::string spec = WriteLineShards("error", 20, 10);
+  // With one thread, shards are read in order and none starts after the
+  // error.
+  std::atomic<int> max_shard = -1;
+  absl::Status status = ForEachShardLine(
+      spec, {.num_threads = 1}, [&](int shard, absl::string_view line) {
+        max_shard = std::max<int>(max_shard, shard);
+        if (shard == 5) {
+          return absl::DataLossError(absl::StrCat("bad shard ", shard));
+        }
+        return absl::OkStatus();
+      });
+  EXPECT_EQ(status, absl::DataLossError("bad shard 5"));
+  EXPECT_EQ(max_shard, 5);
+
+  // With several threads, the error of whichever shard fails first.
+  status = ForEachShardLine(
+      spec, {.num_threads = 4}, [&](int shard, absl::string_view line) {
+        if (shard % 3 == 2) {
+          return absl::DataLossError(absl::StrCat("bad shard ", shard));
+        }
+        return absl::OkStatus();
+      });
+  EXPECT_EQ(status.code(), absl::StatusCode::kDataLoss);
+
+  // A bad spec fails before any shard is read.
+  EXPECT_EQ(ForEachShardLine(TestFile("error@0"), {},
+                             [](int, absl::string_view) {
+                               ADD_FAILURE();
+                               return absl::OkStatus();
+                             })
+                .code(),
+            absl::StatusCode::kInvalidArgument);
+}
+
+}  // namespace
+}  // namespace gxl
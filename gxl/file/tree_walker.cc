@@ -0,0 +1,307 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gxl/file/tree_walker.h"
+
+#ifndef _WIN32
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif  // _WIN32
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif  // __linux__
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/function_ref.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/types/span.h"
+#include "gxl/file/internal/thread_pool.h"
+#include "gxl/file/path.h"
+
+namespace gxl {
+namespace {
+
+#ifndef _WIN32
+
+// Large enough for thousands of entries per system call.
+constexpr size_t kDirentBufferSize = 256 << 10;
+
+bool IsDotOrDotDot(const char* name) {
+  return name[0] == '.' &&
+         (name[1] == '\0' || (name[1] == '.' && name[2] == '\0'));
+}
+
+DirEntry::Type TypeFromDType(unsigned char d_type) {
+  switch (d_type) {
+    case DT_REG:
+      return DirEntry::Type::kFile;
+    case DT_DIR:
+      return DirEntry::Type::kDirectory;
+    case DT_LNK:
+      return DirEntry::Type::kSymlink;
+    case DT_UNKNOWN:
+      return DirEntry::Type::kUnknown;
+    default:
+      return DirEntry::Type::kOther;
+  }
+}
+
+DirEntry::Type TypeFromMode(mode_t mode) {
+  if (S_ISREG(mode)) {
+    return DirEntry::Type::kFile;
+  }
+  if (S_ISDIR(mode)) {
+    return DirEntry::Type::kDirectory;
+  }
+  if (S_ISLNK(mode)) {
+    return DirEntry::Type::kSymlink;
+  }
+  return DirEntry::Type::kOther;
+}
+
+using DirentCallback =
+    absl::FunctionRef<absl::Status(int dir_fd, const char* name,
+                                   unsigned char d_type)>;
+
+absl::Status ReadDirectoryError(absl::string_view dir) {
+  return absl::ErrnoToStatus(
+      errno, absl::StrCat("Could not read directory '", dir, "'"));
+}
+
+#ifdef __linux__
+// Reads the directory with getdents64(), which returns as many entries as fit
+// in "buffer" per call, where readdir() is limited to glibc's small internal
+// buffer.
+absl::Status ReadDirectory(const std::string& dir, std::vector<char>* buffer,
+                           DirentCallback fn) {
+  const int fd = open(dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+  if (fd < 0) {
+    return ReadDirectoryError(dir);
+  }
+  absl::Status status;
+  while (status.ok()) {
+    const long n =  // NOLINT(runtime/int)
+        syscall(SYS_getdents64, fd, buffer->data(), buffer->size());
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      status = ReadDirectoryError(dir);
+      break;
+    }
+    if (n == 0) {
+      break;
+    }
+    // struct linux_dirent64: d_ino (8 bytes), d_off (8), d_reclen (2),
+    // d_type (1), then the null-terminated d_name.
+    for (long pos = 0; pos < n && status.ok();) {  // NOLINT(runtime/int)
+      const char* record = buffer->data() + pos;
+      uint16_t reclen;
+      memcpy(&reclen, record + 16, sizeof(reclen));
+      const unsigned char d_type = record[18];
+      const char* name = record + 19;
+      if (!IsDotOrDotDot(name)) {
+        status = fn(fd, name, d_type);
+      }
+      pos += reclen;
+    }
+  }
+  close(fd);
+  return status;
+}
+#else   // __linux__
+absl::Status ReadDirectory(const std::string& dir,
+                           std::vector<char>* /*buffer*/, DirentCallback fn) {
+  DIR* d = opendir(dir.c_str());
+  if (d == nullptr) {
+    return ReadDirectoryError(dir);
+  }
+  absl::Status status;
+  while (status.ok()) {
+    errno = 0;
+    const struct dirent* entry = readdir(d);
+    if (entry == nullptr) {
+      if (errno != 0) {
+        status = ReadDirectoryError(dir);
+      }
+      break;
+    }
+    if (!IsDotOrDotDot(entry->d_name)) {
+      status = fn(dirfd(d), entry->d_name, entry->d_type);
+    }
+  }
+  closedir(d);
+  return status;
+}
+#endif  // __linux__
+
+class TreeWalker {
+ public:
+  TreeWalker(absl::string_view root, const WalkOptions& options,
+             absl::FunctionRef<absl::Status(absl::Span<DirEntry>)> fn)
+      : root_(root),
+        options_(options),
+        batch_size_(std::max<size_t>(options.batch_size, 1)),
+        fn_(fn) {
+    dirs_.push_back(root_);
+  }
+
+  // Reads directories until the tree is exhausted or an error occurred.
+  void Work() {
+    std::vector<char> buffer(kDirentBufferSize);
+    std::vector<DirEntry> batch;
+    std::vector<std::string> subdirs;
+    while (true) {
+      std::string dir;
+      {
+        absl::MutexLock lock(&mu_);
+        mu_.Await(absl::Condition(this, &TreeWalker::HasWorkOrDone));
+        if (!status_.ok() || dirs_.empty()) {
+          break;
+        }
+        // Depth first, which keeps the stack of pending directories short.
+        dir = std::move(dirs_.back());
+        dirs_.pop_back();
+        ++active_;
+      }
+      absl::Status status =
+          ReadDirectory(dir, &buffer,
+                        [&](int dir_fd, const char* name, unsigned char type) {
+                          return AddEntry(dir, dir_fd, name, type, &batch,
+                                          &subdirs);
+                        });
+      if (absl::IsNotFound(status) && dir != root_) {
+        status = absl::OkStatus();  // Removed while walking.
+      }
+      absl::MutexLock lock(&mu_);
+      --active_;
+      for (std::string& subdir : subdirs) {
+        dirs_.push_back(std::move(subdir));
+      }
+      subdirs.clear();
+      UpdateStatus(std::move(status));
+    }
+    if (!batch.empty()) {
+      absl::Status status = Emit(&batch);
+      absl::MutexLock lock(&mu_);
+      UpdateStatus(std::move(status));
+    }
+  }
+
+  absl::Status status() {
+    absl::MutexLock lock(&mu_);
+    return status_;
+  }
+
+ private:
+  bool HasWorkOrDone() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    return !status_.ok() || !dirs_.empty() || active_ == 0;
+  }
+
+  void UpdateStatus(absl::Status status) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    if (!status.ok() && status_.ok()) {
+      status_ = std::move(status);
+      failed_.store(true, std::memory_order_relaxed);
+    }
+  }
+
+  absl::Status AddEntry(const std::string& dir, int dir_fd, const char* name,
+                        unsigned char d_type, std::vector<DirEntry>* batch,
+                        std::vector<std::string>* subdirs) {
+    DirEntry entry{JoinPath(dir, name), TypeFromDType(d_type)};
+    if (entry.type == DirEntry::Type::kUnknown) {
+      // Only some file systems leave d_type unset.
+      struct stat f_stat;
+      if (fstatat(dir_fd, name, &f_stat, AT_SYMLINK_NOFOLLOW) == 0) {
+        entry.type = TypeFromMode(f_stat.st_mode);
+      }
+    }
+    if (options_.exclude && options_.exclude(entry)) {
+      return absl::OkStatus();
+    }
+    if (entry.type == DirEntry::Type::kDirectory) {
+      subdirs->push_back(entry.path);
+    }
+    if (!options_.include || options_.include(entry)) {
+      batch->push_back(std::move(entry));
+      if (batch->size() >= batch_size_) {
+        return Emit(batch);
+      }
+    }
+    return absl::OkStatus();
+  }
+
+  absl::Status Emit(std::vector<DirEntry>* batch) {
+    if (failed_.load(std::memory_order_relaxed)) {
+      return absl::CancelledError();  // Superseded by the first error.
+    }
+    absl::Status status;
+    {
+      absl::MutexLock lock(&fn_mu_);
+      status = fn_(absl::MakeSpan(*batch));
+    }
+    batch->clear();
+    return status;
+  }
+
+  const std::string root_;
+  const WalkOptions& options_;
+  const size_t batch_size_;
+  const absl::FunctionRef<absl::Status(absl::Span<DirEntry>)> fn_;
+  std::atomic<bool> failed_{false};
+
+  absl::Mutex mu_;
+  std::vector<std::string> dirs_ ABSL_GUARDED_BY(mu_);
+  int active_ ABSL_GUARDED_BY(mu_) = 0;  // Directories being read.
+  absl::Status status_ ABSL_GUARDED_BY(mu_);
+
+  absl::Mutex fn_mu_;  // Serializes calls to fn_.
+};
+
+#endif  // _WIN32
+
+}  // namespace
+
+absl::Status WalkDirectoryTree(
+    absl::string_view root, const WalkOptions& options,
+    absl::FunctionRef<absl::Status(absl::Span<DirEntry> batch)> fn) {
+#ifndef _WIN32
+  TreeWalker walker(root, options, fn);
+  {
+    internal::ThreadPool pool(options.num_threads);
+    for (int i = 0; i < pool.num_threads(); ++i) {
+      pool.Schedule([&walker] { walker.Work(); });
+    }
+  }  // Waits for the workers.
+  return walker.status();
+#else   // _WIN32
+  return absl::UnimplementedError(
+      absl::StrCat("Cannot walk '", root, "': not supported on this platform"));
+#endif  // _WIN32
+}
+
+}  // namespace gxl
@@ -0,0 +1,98 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GXL_FILE_TREE_WALKER_H_
+#define GXL_FILE_TREE_WALKER_H_
+
+#include <cstddef>
+#include <functional>
+#include <string>
+
+#include "absl/functional/function_ref.h"
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+
+namespace gxl {
+
+// An entry found by WalkDirectoryTree().
+struct DirEntry {
+  enum class Type {
+    kUnknown,
+    kFile,
+    kDirectory,
+    kSymlink,
+    kOther,  // Device, FIFO, socket, ...
+  };
+
+  // The root passed to WalkDirectoryTree() joined with the entry's relative
+  // path.
+  std::string path;
+  Type type = Type::kUnknown;
+};
+
+struct WalkOptions {
+  // Number of directories read concurrently. 0 means one per CPU.
+  int num_threads = 0;
+
+  // Maximum number of entries passed to the callback at once. Each thread
+  // buffers at most one batch.
+  size_t batch_size = 4096;
+
+  // If set, only entries for which it returns true are passed to the
+  // callback. Directories are descended into either way.
+  //
+  // Both predicates are called from all worker threads at once, so they
+  // must be thread-safe.
+  std::function<bool(const DirEntry&)> include;
+
+  // If set, entries for which it returns true are skipped altogether: they
+  // are not passed to the callback and, for directories, not descended into.
+  std::function<bool(const DirEntry&)> exclude;
+};
+
+// Calls "fn" with batches of the entries below "root", excluding "root"
+// itself, reading several directories in parallel.
+//
+// Entry types come from the directory listing itself, so the walk costs one
+// stat() per entry only on file systems that do not report them. Symbolic
+// links are reported as such and not followed. Batches arrive in no
+// particular order; "fn" is called from worker threads, but never
+// concurrently. The entries may be moved out of the batch.
+//
+// The walk stops at the first error, from reading a directory or from "fn",
+// and returns it.
+//
+// Usage:
+//
+//   WalkOptions options;
+//   options.exclude = [](const DirEntry& entry) {
+//     return absl::EndsWith(entry.path, "/.git");
+//   };
+//   std::vector<std::string> files;
+//   RETURN_IF_ERROR(WalkDirectoryTree(
+//       root, options, [&](absl::Span<DirEntry> batch) {
+//         for (DirEntry& entry : batch) {
+//           if (entry.type == DirEntry::Type::kFile) {
+//             files.push_back(std::move(entry.path));
+//           }
+//         }
+//         return absl::OkStatus();
+//       }));
+absl::Status WalkDirectoryTree(
+    absl::string_view root, const WalkOptions& options,
+    absl::FunctionRef<absl::Status(absl::Span<DirEntry> batch)> fn);
+
+}  // namespace gxl
+
+#endif  // GXL_FILE_TREE_WALKER_H_
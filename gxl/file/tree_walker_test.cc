@@ -0,0 +1,151 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gxl/file/tree_walker.h"
+
+#include <unistd.h>
+
+#include <map>
+#include <string>
+
+#include "absl/status/status.h"
+#include "absl/strings/match.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+#include "gtest/gtest.h"
+#include "gxl/file/file.h"
+#include "gxl/file/filesystem.h"
+#include "gxl/file/path.h"
+
+namespace gxl {
+namespace {
+
+using Type = DirEntry::Type;
+
+// Builds a tree with nested directories and symbolic links, once per test
+// binary run.
+std::string TestTree() {
+  static const std::string* const root = [] {
+    auto* root = new std::string(JoinPath(
+        testing::TempDir(), absl::StrCat("tree_walker_test_", getpid())));
+    EXPECT_TRUE(RecursivelyCreateDir(JoinPath(*root, "sub/deep/deeper")).ok());
+    EXPECT_TRUE(RecursivelyCreateDir(JoinPath(*root, "skip/inner")).ok());
+    for (absl::string_view file :
+         {"a.txt", "sub/b.txt", "sub/deep/c.txt", "sub/deep/deeper/d.txt",
+          "skip/e.txt", "skip/inner/f.txt"}) {
+      EXPECT_TRUE(
+          SetContents(JoinPath(*root, file), file, file::Defaults()).ok());
+    }
+    EXPECT_EQ(symlink("sub", JoinPath(*root, "link_to_dir").c_str()), 0);
+    EXPECT_EQ(symlink("a.txt", JoinPath(*root, "link_to_file").c_str()), 0);
+    EXPECT_EQ(symlink("missing", JoinPath(*root, "dangling").c_str()), 0);
+    return root;
+  }();
+  return *root;
+}
+
+// Returns the entries found below TestTree(), by path relative to it.
+std::map<std::string, Type> Walk(const WalkOptions& options,
+                                 absl::Status* status) {
+  const std::string root = TestTree();
+  std::map<std::string, Type> entries;
+  *status = WalkDirectoryTree(
+      root, options, [&](absl::Span<DirEntry> batch) {
+        for (const DirEntry& entry : batch) {
+          EXPECT_TRUE(absl::StartsWith(entry.path, root + "/")) << entry.path;
+          const bool inserted =
+              entries.emplace(entry.path.substr(root.size() + 1), entry.type)
+                  .second;
+          EXPECT_TRUE(inserted) << "Duplicate entry " << entry.path;
+        }
+        return absl::OkStatus();
+      });
+  return entries;
+}
+
+TEST(WalkDirectoryTreeTest, FindsEverything) {
+  const std::map<std::string, Type> expected = {
+      {"a.txt", Type::kFile},
+      {"dangling", Type::kSymlink},
+      {"link_to_dir", Type::kSymlink},
+      {"link_to_file", Type::kSymlink},
+      {"skip", Type::kDirectory},
+      {"skip/e.txt", Type::kFile},
+      {"skip/inner", Type::kDirectory},
+      {"skip/inner/f.txt", Type::kFile},
+      {"sub", Type::kDirectory},
+      {"sub/b.txt", Type::kFile},
+      {"sub/deep", Type::kDirectory},
+      {"sub/deep/c.txt", Type::kFile},
+      {"sub/deep/deeper", Type::kDirectory},
+      {"sub/deep/deeper/d.txt", Type::kFile},
+  };
+  for (int num_threads : {1, 4}) {
+    for (size_t batch_size : {1, 3, 4096}) {
+      absl::Status status;
+      EXPECT_EQ(Walk({.num_threads = num_threads, .batch_size = batch_size},
+                     &status),
+                expected)
+          << "num_threads: " << num_threads << " batch_size: " << batch_size;
+      EXPECT_TRUE(status.ok()) << status;
+    }
+  }
+}
+
+TEST(WalkDirectoryTreeTest, FiltersEntries) {
+  WalkOptions options;
+  options.num_threads = 4;
+  // Skips the "skip" subtree without descending into it.
+  options.exclude = [](const DirEntry& entry) {
+    EXPECT_FALSE(absl::StrContains(entry.path, "/skip/")) << entry.path;
+    return absl::EndsWith(entry.path, "/skip");
+  };
+  // Only reports files, but still descends into directories.
+  options.include = [](const DirEntry& entry) {
+    return entry.type == Type::kFile;
+  };
+  absl::Status status;
+  const std::map<std::string, Type> expected = {
+      {"a.txt", Type::kFile},
+      {"sub/b.txt", Type::kFile},
+      {"sub/deep/c.txt", Type::kFile},
+      {"sub/deep/deeper/d.txt", Type::kFile},
+  };
+  EXPECT_EQ(Walk(options, &status), expected);
+  EXPECT_TRUE(status.ok()) << status;
+}
+
+TEST(WalkDirectoryTreeTest, ReturnsErrors) {
+  EXPECT_EQ(WalkDirectoryTree(JoinPath(testing::TempDir(), "missing_tree"),
+                              {},
+                              [](absl::Span<DirEntry>) {
+                                return absl::OkStatus();
+                              })
+                .code(),
+            absl::StatusCode::kNotFound);
+
+  // With one thread, no other batch can be on its way to the callback.
+  int calls = 0;
+  const absl::Status status = WalkDirectoryTree(
+      TestTree(), {.num_threads = 1, .batch_size = 1},
+      [&calls](absl::Span<DirEntry>) {
+        ++calls;
+        return absl::CancelledError("stop");
+      });
+  EXPECT_EQ(status, absl::CancelledError("stop"));
+  EXPECT_EQ(calls, 1);
+}
+
+}  // namespace
+}  // namespace gxl
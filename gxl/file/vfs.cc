@@ -0,0 +1,100 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gxl/file/vfs.h"
+
+#include <string>
+
+#include "absl/base/const_init.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/status/status.h"
+#include "absl/strings/ascii.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/synchronization/mutex.h"
+
+namespace gxl {
+namespace {
+
+constexpr absl::string_view kSchemeSeparator = "://";
+
+bool IsValidScheme(absl::string_view scheme) {
+  if (scheme.empty() || !absl::ascii_islower(scheme[0])) {
+    return false;
+  }
+  for (const char c : scheme) {
+    if (!absl::ascii_islower(c) && !absl::ascii_isdigit(c) && c != '+' &&
+        c != '-' && c != '.') {
+      return false;
+    }
+  }
+  return true;
+}
+
+ABSL_CONST_INIT absl::Mutex registry_mutex(absl::kConstInit);
+
+// Never deleted, so that lookups need no lock against destruction at exit.
+absl::flat_hash_map<std::string, FileSystem*>& Registry()
+    ABSL_SHARED_LOCKS_REQUIRED(registry_mutex) {
+  static auto* const registry =
+      new absl::flat_hash_map<std::string, FileSystem*>();
+  return *registry;
+}
+
+}  // namespace
+
+absl::Status RegisterFileSystem(absl::string_view scheme,
+                                FileSystem* file_system) {
+  if (!IsValidScheme(scheme)) {
+    return absl::Status(absl::StatusCode::kInvalidArgument,
+                        absl::StrCat("Invalid file system scheme '", scheme,
+                                     "'"));
+  }
+  absl::MutexLock lock(&registry_mutex);
+  if (!Registry().emplace(scheme, file_system).second) {
+    return absl::Status(
+        absl::StatusCode::kAlreadyExists,
+        absl::StrCat("A file system is already registered for '", scheme,
+                     "://'"));
+  }
+  return absl::OkStatus();
+}
+
+absl::Status UnregisterFileSystem(absl::string_view scheme) {
+  absl::MutexLock lock(&registry_mutex);
+  if (Registry().erase(scheme) == 0) {
+    return absl::Status(
+        absl::StatusCode::kNotFound,
+        absl::StrCat("No file system is registered for '", scheme, "://'"));
+  }
+  return absl::OkStatus();
+}
+
+FileSystem* GetFileSystem(absl::string_view path,
+                          absl::string_view* relative_path) {
+  const size_t separator = path.find(kSchemeSeparator);
+  if (separator == absl::string_view::npos) {
+    return nullptr;
+  }
+  const absl::string_view scheme = path.substr(0, separator);
+  absl::ReaderMutexLock lock(&registry_mutex);
+  const auto it = Registry().find(scheme);
+  if (it == Registry().end()) {
+    return nullptr;
+  }
+  *relative_path = path.substr(separator + kSchemeSeparator.size());
+  return it->second;
+}
+
+}  // namespace gxl
@@ -0,0 +1,83 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// A registry of file systems keyed by URL-like scheme.
+//
+// Paths of the form "<scheme>://<path>" whose scheme was registered with
+// RegisterFileSystem() are served by that file system instead of the local
+// one: File::Open(), GetContents(), SetContents(), Exists(), Delete() and
+// RecursivelyCreateDir() all dispatch on the scheme. Every other path, such
+// as "/tmp/foo" or "foo/bar", goes to the local file system as before.
+//
+// Usage:
+//
+//   static MemoryFileSystem* const mem_fs = new MemoryFileSystem();
+//   CHECK_OK(RegisterFileSystem("mem", mem_fs));
+//   RETURN_IF_ERROR(SetContents("mem://config/flags", flags,
+//                               file::Defaults()));
+
+#ifndef GXL_FILE_VFS_H_
+#define GXL_FILE_VFS_H_
+
+#include <string>
+
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+
+namespace gxl {
+
+// A file system. Paths passed to its methods have the "<scheme>://" prefix
+// removed. Implementations must be thread-safe.
+class FileSystem {
+ public:
+  virtual ~FileSystem() = default;
+
+  // Replaces "*output" with the contents of "path". Returns kNotFound if there
+  // is no such file.
+  virtual absl::Status GetContents(absl::string_view path,
+                                   std::string* output) = 0;
+
+  // Creates or replaces the file "path".
+  virtual absl::Status SetContents(absl::string_view path,
+                                   absl::string_view contents) = 0;
+
+  // Returns OK if "path" is an existing file or directory, kNotFound if not.
+  virtual absl::Status Exists(absl::string_view path) = 0;
+
+  // Deletes the file or empty directory "path".
+  virtual absl::Status Delete(absl::string_view path) = 0;
+
+  // Creates "path" and any missing parent directories.
+  virtual absl::Status RecursivelyCreateDir(absl::string_view path) = 0;
+};
+
+// Routes paths starting with "<scheme>://" to "file_system", which is not
+// owned and must outlive its registration. Schemes consist of lowercase
+// letters, digits, '+', '-' and '.', starting with a letter. Returns
+// kAlreadyExists if "scheme" is registered already.
+absl::Status RegisterFileSystem(absl::string_view scheme,
+                                FileSystem* file_system);
+
+// Removes the registration of "scheme". Returns kNotFound if there is none.
+// The caller must ensure no other thread is using the file system.
+absl::Status UnregisterFileSystem(absl::string_view scheme);
+
+// Returns the file system registered for the scheme of "path" and sets
+// "*relative_path" to the rest of "path", or returns nullptr for local paths.
+// This is cheap for paths without "://".
+FileSystem* GetFileSystem(absl::string_view path,
+                          absl::string_view* relative_path);
+
+}  // namespace gxl
+
+#endif  // GXL_FILE_VFS_H_
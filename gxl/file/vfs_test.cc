@@ -0,0 +1,220 @@
+// Copyright 2010-2024 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gxl/file/vfs.h"
+
+#include <string>
+#include <thread>  // NOLINT
+
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/synchronization/notification.h"
+#include "gtest/gtest.h"
+#include "gxl/file/caching_file_system.h"
+#include "gxl/file/file.h"
+#include "gxl/file/filesystem.h"
+#include "gxl/file/memory_file_system.h"
+
+namespace gxl {
+namespace {
+
+TEST(VfsTest, RegisterFileSystem) {
+  MemoryFileSystem file_system;
+  EXPECT_EQ(RegisterFileSystem("Bad", &file_system).code(),
+            absl::StatusCode::kInvalidArgument);
+  ASSERT_TRUE(RegisterFileSystem("regtest", &file_system).ok());
+  EXPECT_EQ(RegisterFileSystem("regtest", &file_system).code(),
+            absl::StatusCode::kAlreadyExists);
+
+  absl::string_view path;
+  EXPECT_EQ(GetFileSystem("regtest://a/b", &path), &file_system);
+  EXPECT_EQ(path, "a/b");
+  EXPECT_EQ(GetFileSystem("other://a/b", &path), nullptr);
+  EXPECT_EQ(GetFileSystem("/tmp/a", &path), nullptr);
+
+  ASSERT_TRUE(UnregisterFileSystem("regtest").ok());
+  EXPECT_EQ(GetFileSystem("regtest://a/b", &path), nullptr);
+  EXPECT_EQ(UnregisterFileSystem("regtest").code(),
+            absl::StatusCode::kNotFound);
+}
+
+TEST(VfsTest, MemoryFileSystem) {
+  MemoryFileSystem file_system;
+  std::string contents;
+  EXPECT_EQ(file_system.GetContents("a/b", &contents).code(),
+            absl::StatusCode::kNotFound);
+  ASSERT_TRUE(file_system.SetContents("a/b", "hello").ok());
+  ASSERT_TRUE(file_system.GetContents("/a//b", &contents).ok());
+  EXPECT_EQ(contents, "hello");
+
+  EXPECT_EQ(file_system.Exists("x/y").code(), absl::StatusCode::kNotFound);
+  ASSERT_TRUE(file_system.RecursivelyCreateDir("x/y").ok());
+  EXPECT_TRUE(file_system.Exists("x").ok());
+  EXPECT_TRUE(file_system.Exists("x/y").ok());
+  EXPECT_FALSE(file_system.SetContents("x/y", "").ok());
+  EXPECT_FALSE(file_system.RecursivelyCreateDir("a/b/c").ok());
+
+  EXPECT_EQ(file_system.Delete("x").code(),
+            absl::StatusCode::kFailedPrecondition);
+  EXPECT_TRUE(file_system.Delete("x/y").ok());
+  EXPECT_TRUE(file_system.Delete("x").ok());
+  EXPECT_TRUE(file_system.Delete("a/b").ok());
+  EXPECT_EQ(file_system.Exists("a/b").code(), absl::StatusCode::kNotFound);
+}
+
+TEST(VfsTest, DispatchesOnScheme) {
+  MemoryFileSystem file_system;
+  ASSERT_TRUE(RegisterFileSystem("memtest", &file_system).ok());
+
+  ASSERT_TRUE(RecursivelyCreateDir("memtest://dir/sub").ok());
+  EXPECT_TRUE(Exists("memtest://dir/sub", file::Defaults()).ok());
+  ASSERT_TRUE(
+      SetContents("memtest://dir/file", "contents", file::Defaults()).ok());
+  std::string contents;
+  ASSERT_TRUE(
+      GetContents("memtest://dir/file", &contents, file::Defaults()).ok());
+  EXPECT_EQ(contents, "contents");
+
+  File* file = File::Open("memtest://dir/file", "a");
+  ASSERT_NE(file, nullptr);
+  EXPECT_TRUE(file->WriteLine(" appended"));
+  EXPECT_EQ(file->Size(), 18);
+  EXPECT_TRUE(file->Close(file::Defaults()).ok());
+  file = File::Open("memtest://dir/file", "r");
+  ASSERT_NE(file, nullptr);
+  EXPECT_EQ(file->ReadToString(&contents, 100), 18);
+  EXPECT_EQ(contents, "contents appended\n");
+  EXPECT_TRUE(file->Close(file::Defaults()).ok());
+  EXPECT_EQ(File::Open("memtest://dir/file", "r+"), nullptr);
+  EXPECT_EQ(File::Open("memtest://dir/missing", "r"), nullptr);
+
+  EXPECT_TRUE(Delete("memtest://dir/file", file::Defaults()).ok());
+  EXPECT_FALSE(File::Exists("memtest://dir/file"));
+  ASSERT_TRUE(UnregisterFileSystem("memtest").ok());
+}
+
+TEST(VfsTest, CachingFileSystem) {
+  MemoryFileSystem base;
+  CachingFileSystem file_system(&base, {.max_bytes = 10});
+  ASSERT_TRUE(base.SetContents("a", "aaaa").ok());
+  ASSERT_TRUE(base.SetContents("b", "bbbb").ok());
+
+  std::string contents;
+  ASSERT_TRUE(file_system.GetContents("a", &contents).ok());
+  ASSERT_TRUE(file_system.GetContents("a", &contents).ok());
+  EXPECT_EQ(contents, "aaaa");
+  EXPECT_EQ(file_system.hits(), 1);
+  EXPECT_EQ(file_system.misses(), 1);
+
+  // Writes go through, and "b" pushes the least recently used "a" out.
+  ASSERT_TRUE(file_system.SetContents("a", "AAAA").ok());
+  ASSERT_TRUE(base.GetContents("a", &contents).ok());
+  EXPECT_EQ(contents, "AAAA");
+  ASSERT_TRUE(file_system.GetContents("b", &contents).ok());
+  ASSERT_TRUE(file_system.SetContents("c", "cccc").ok());
+  ASSERT_TRUE(file_system.GetContents("a", &contents).ok());
+  EXPECT_EQ(contents, "AAAA");
+  EXPECT_EQ(file_system.misses(), 3);
+
+  ASSERT_TRUE(file_system.Delete("a").ok());
+  EXPECT_EQ(file_system.GetContents("a", &contents).code(),
+            absl::StatusCode::kNotFound);
+}
+
+// A MemoryFileSystem whose Delete() waits until the test lets it proceed.
+class BlockingDeleteFileSystem : public MemoryFileSystem {
+ public:
+  absl::Status Delete(absl::string_view path) override {
+    delete_started.Notify();
+    proceed.WaitForNotification();
+    return MemoryFileSystem::Delete(path);
+  }
+
+  absl::Notification delete_started;
+  absl::Notification proceed;
+};
+
+TEST(VfsTest, CachingFileSystemConcurrentDelete) {
+  BlockingDeleteFileSystem base;
+  CachingFileSystem file_system(&base, {});
+  ASSERT_TRUE(base.SetContents("a", "aaaa").ok());
+  std::thread deleter([&file_system] {
+    EXPECT_TRUE(file_system.Delete("a").ok());
+  });
+
+  // Reads the file while it is being deleted.
+  base.delete_started.WaitForNotification();
+  std::string contents;
+  ASSERT_TRUE(file_system.GetContents("a", &contents).ok());
+  EXPECT_EQ(contents, "aaaa");
+  base.proceed.Notify();
+  deleter.join();
+
+  // The read did not leave the deleted file in the cache.
+  EXPECT_EQ(file_system.GetContents("a", &contents).code(),
+            absl::StatusCode::kNotFound);
+  EXPECT_EQ(file_system.Exists("a").code(), absl::StatusCode::kNotFound);
+}
+
+// A MemoryFileSystem whose SetContents() waits after writing until the test
+// lets it return.
+class BlockingWriteFileSystem : public MemoryFileSystem {
+ public:
+  absl::Status SetContents(absl::string_view path,
+                           absl::string_view contents) override {
+    absl::Status status = MemoryFileSystem::SetContents(path, contents);
+    write_done.Notify();
+    proceed.WaitForNotification();
+    return status;
+  }
+
+  absl::Notification write_done;
+  absl::Notification proceed;
+};
+
+TEST(VfsTest, CachingFileSystemDeleteDuringWrite) {
+  BlockingWriteFileSystem base;
+  CachingFileSystem file_system(&base, {});
+  std::thread writer([&file_system] {
+    EXPECT_TRUE(file_system.SetContents("a", "aaaa").ok());
+  });
+
+  // Deletes the file between the write and its caching.
+  base.write_done.WaitForNotification();
+  ASSERT_TRUE(file_system.Delete("a").ok());
+  base.proceed.Notify();
+  writer.join();
+
+  // The write did not cache the deleted file.
+  std::string contents;
+  EXPECT_EQ(file_system.GetContents("a", &contents).code(),
+            absl::StatusCode::kNotFound);
+  EXPECT_EQ(file_system.Exists("a").code(), absl::StatusCode::kNotFound);
+}
+
+TEST(VfsTest, LocalFileSystem) {
+  const std::string filename = absl::StrCat(testing::TempDir(), "/vfs_local");
+  ASSERT_TRUE(LocalFileSystem()->SetContents(filename, "local").ok());
+  std::string contents;
+  ASSERT_TRUE(LocalFileSystem()->GetContents(filename, &contents).ok());
+  EXPECT_EQ(contents, "local");
+  ASSERT_TRUE(LocalFileSystem()->Delete(filename).ok());
+  EXPECT_EQ(LocalFileSystem()->Exists(filename).code(),
+            absl::StatusCode::kNotFound);
+  EXPECT_EQ(LocalFileSystem()->GetContents(filename, &contents).code(),
+            absl::StatusCode::kNotFound);
+}
+
+}  // namespace
+}  // namespace gxl
@@ -16,27 +16,52 @@
 
 #include "gxl/utf8/unicodetext.h"
 
-#include <algorithm>  // for max
-#include <string>     // for memcpy, NULL, memcmp, etc
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include <algorithm>   // for max
+#include <cstdint>     // for uint64_t
+#include <cstring>     // for memchr, memcmp, memcpy
+#include <string>      // for std::string
+#include <vector>      // for std::vector
 
 #include "absl/log/check.h"
 #include "absl/log/log.h"
+#include "absl/numeric/bits.h"           // for countr_zero, popcount
 #include "absl/strings/str_format.h"     // for StrFormat, StringAppendF
 #include "absl/strings/string_view.h"    // for string_view
 #include "gxl/utf8/unilib.h"             // for IsInterchangeValid, etc
 #include "gxl/utf8/unilib_utf8_utils.h"  // for OneCharLen
 #include "third_party/utf/utf.h"         // for isvalidcharntorune, etc
 
-static int CodepointDistance(const char* start, const char* end) {
-  int n = 0;
+static ptrdiff_t CodepointDistance(const char* start, const char* end) {
+  ptrdiff_t n = 0;
+  const char* p = start;
+#ifdef __SSE2__
+  // Counts the non-trail-bytes of each 64-byte block with one popcount. As
+  // signed chars, those are the bytes greater than -0x41.
+  const __m128i trail_byte_max = _mm_set1_epi8(-0x41);
+  for (; end - p >= 64; p += 64) {
+    uint64_t mask = 0;
+    for (int i = 0; i < 4; ++i) {
+      const __m128i bytes =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16 * i));
+      mask |= static_cast<uint64_t>(static_cast<uint16_t>(
+                  _mm_movemask_epi8(_mm_cmpgt_epi8(bytes, trail_byte_max))))
+              << (16 * i);
+    }
+    n += absl::popcount(mask);
+  }
+#endif  // __SSE2__
   // Increment n on every non-trail-byte.
-  for (const char* p = start; p < end; ++p) {
+  for (; p < end; ++p) {
     n += (*reinterpret_cast<const signed char*>(p) >= -0x40);
   }
   return n;
 }
 
-static int CodepointCount(const char* utf8, int len) {
+static ptrdiff_t CodepointCount(const char* utf8, ptrdiff_t len) {
   return CodepointDistance(utf8, utf8 + len);
 }
 
@@ -48,7 +73,7 @@ UnicodeText::const_iterator::difference_type distance(
 
 // ---------- Utility ----------
 
-static int ConvertToInterchangeValid(char* start, int len) {
+static ptrdiff_t ConvertToInterchangeValid(char* start, ptrdiff_t len) {
   // This routine is called only when we've discovered that a UTF-8 buffer
   // that was passed to CopyUTF8, TakeOwnershipOfUTF8, or PointToUTF8
   // was not interchange valid. This indicates a bug in the caller, and
@@ -67,7 +92,7 @@ static int ConvertToInterchangeValid(char* start, int len) {
   char* out = start;
   char* const end = start + len;
   while (start < end) {
-    int good = UniLib::SpanInterchangeValid(start, end - start);
+    ptrdiff_t good = UniLib::SpanInterchangeValid(start, end - start);
     if (good > 0) {
       if (out != start) {
         memmove(out, start, good);
@@ -81,7 +106,8 @@ static int ConvertToInterchangeValid(char* start, int len) {
     // Is the current string invalid UTF8 or just non-interchange UTF8?
     char32 rune;
     int n;
-    if (isvalidcharntorune(start, end - start, &rune, &n)) {
+    if (isvalidcharntorune(start, std::min<ptrdiff_t>(end - start, UTFmax),
+                           &rune, &n)) {
       // structurally valid UTF8, but not interchange valid
       start += n;  // Skip over the whole character.
     } else {       // bad UTF8
@@ -98,11 +124,23 @@ static int ConvertToInterchangeValid(char* start, int len) {
 
 // After reserve(), resize(), or clear(), we're an owner, not an alias.
 
-void UnicodeText::Repr::reserve(int new_capacity) {
+void UnicodeText::Repr::reserve(ptrdiff_t new_capacity) {
   // If there's already enough capacity, and we're an owner, do nothing.
   if (capacity_ >= new_capacity && ours_)
     return;
 
+  // Short texts move to the inline buffer instead of the heap.
+  if (std::max(new_capacity, size_) <= kInlineCapacity && data_ != inline_) {
+    if (data_) {
+      memcpy(inline_, data_, size_);
+      FreeData();
+    }
+    data_ = inline_;
+    capacity_ = kInlineCapacity;
+    ours_ = true;
+    return;
+  }
+
   // Otherwise, allocate a new buffer.
   capacity_ = std::max(new_capacity, (3 * capacity_) / 2 + 20);
   char* new_data = new char[capacity_];
@@ -110,15 +148,15 @@ void UnicodeText::Repr::reserve(int new_capacity) {
   // If there is an old buffer, copy it into the new buffer.
   if (data_) {
     memcpy(new_data, data_, size_);
-    if (ours_)
-      delete[] data_;  // If we owned the old buffer, free it.
+    FreeData();  // If we owned the old buffer, free it.
   }
   data_ = new_data;
   ours_ = true;  // We own the new buffer.
-  // size_ is unchanged.
+  // size_ and codepoint_count_ are unchanged.
 }
 
-void UnicodeText::Repr::resize(int new_size) {
+void UnicodeText::Repr::resize(ptrdiff_t new_size) {
+  InvalidateCodepointCount();
   if (new_size == 0) {
     clear();
   } else {
@@ -135,47 +173,72 @@ void UnicodeText::Repr::resize(int new_size) {
 // This implementation of clear() deallocates the buffer if we're an owner.
 // That's not strictly necessary; we could just set size_ to 0.
 void UnicodeText::Repr::clear() {
-  if (ours_)
-    delete[] data_;
+  FreeData();
   data_ = nullptr;
   size_ = capacity_ = 0;
   ours_ = true;
+  codepoint_count_.store(0, std::memory_order_relaxed);
 }
 
-void UnicodeText::Repr::Copy(const char* data, int size) {
+void UnicodeText::Repr::Copy(const char* data, ptrdiff_t size) {
   resize(size);
   memcpy(data_, data, size);
 }
 
-void UnicodeText::Repr::TakeOwnershipOf(char* data, int size, int capacity) {
+void UnicodeText::Repr::TakeOwnershipOf(char* data, ptrdiff_t size,
+                                        ptrdiff_t capacity) {
+  InvalidateCodepointCount();  // The caller may have changed data in place.
   if (data == data_)
     return;  // We already own this memory. (Weird case.)
-  if (ours_ && data_)
-    delete[] data_;  // If we owned the old buffer, free it.
+  FreeData();  // If we owned the old buffer, free it.
   data_ = data;
   size_ = size;
   capacity_ = capacity;
   ours_ = true;
 }
 
-void UnicodeText::Repr::PointTo(const char* data, int size) {
-  if (ours_ && data_)
-    delete[] data_;  // If we owned the old buffer, free it.
+void UnicodeText::Repr::PointTo(const char* data, ptrdiff_t size) {
+  InvalidateCodepointCount();
+  FreeData();  // If we owned the old buffer, free it.
   data_ = const_cast<char*>(data);
   size_ = size;
   capacity_ = size;
   ours_ = false;
 }
 
-void UnicodeText::Repr::append(const char* bytes, int byte_length) {
+void UnicodeText::Repr::Move(Repr* src) {
+  if (src == this)
+    return;
+  FreeData();
+  if (src->data_ == src->inline_) {
+    // An inline buffer cannot be stolen; copy it instead.
+    memcpy(inline_, src->inline_, src->size_);
+    data_ = inline_;
+  } else {
+    data_ = src->data_;
+  }
+  size_ = src->size_;
+  capacity_ = src->capacity_;
+  ours_ = src->ours_;
+  codepoint_count_.store(src->codepoint_count_.load(std::memory_order_relaxed),
+                         std::memory_order_relaxed);
+  src->data_ = nullptr;
+  src->size_ = src->capacity_ = 0;
+  src->ours_ = true;
+  src->codepoint_count_.store(0, std::memory_order_relaxed);
+}
+
+void UnicodeText::Repr::append(const char* bytes, ptrdiff_t byte_length) {
+  InvalidateCodepointCount();
   reserve(size_ + byte_length);
   memcpy(data_ + size_, bytes, byte_length);
   size_ += byte_length;
 }
 
 std::string UnicodeText::Repr::DebugString() const {
+  const char* kind = !ours_ ? "Alias" : data_ == inline_ ? "Inline" : "Owned";
   return absl::StrFormat("{Repr %p data=%p size=%d capacity=%d %s}", this,
-                         data_, size_, capacity_, ours_ ? "Owned" : "Alias");
+                         data_, size_, capacity_, kind);
 }
 
 // *************** UnicodeText ******************
@@ -188,6 +251,9 @@ UnicodeText::UnicodeText() {}
 // Copy constructor
 UnicodeText::UnicodeText(const UnicodeText& src) { Copy(src); }
 
+// Move constructor
+UnicodeText::UnicodeText(UnicodeText&& src) noexcept { repr_.Move(&src.repr_); }
+
 // Substring constructor
 UnicodeText::UnicodeText(const UnicodeText::const_iterator& first,
                          const UnicodeText::const_iterator& last) {
@@ -210,12 +276,20 @@ UnicodeText& UnicodeText::operator=(const UnicodeText& src) {
   return *this;
 }
 
+UnicodeText& UnicodeText::operator=(UnicodeText&& src) noexcept {
+  repr_.Move(&src.repr_);
+  return *this;
+}
+
 UnicodeText& UnicodeText::Copy(const UnicodeText& src) {
   repr_.Copy(src.repr_.data_, src.repr_.size_);
+  repr_.codepoint_count_.store(
+      src.repr_.codepoint_count_.load(std::memory_order_relaxed),
+      std::memory_order_relaxed);
   return *this;
 }
 
-UnicodeText& UnicodeText::CopyUTF8(const char* buffer, int byte_length) {
+UnicodeText& UnicodeText::CopyUTF8(const char* buffer, ptrdiff_t byte_length) {
   repr_.Copy(buffer, byte_length);
   if (!UniLib::IsInterchangeValid(buffer, byte_length)) {
     LOG(WARNING) << "UTF-8 buffer is not interchange-valid.";
@@ -224,15 +298,17 @@ UnicodeText& UnicodeText::CopyUTF8(const char* buffer, int byte_length) {
   return *this;
 }
 
-UnicodeText& UnicodeText::UnsafeCopyUTF8(const char* buffer, int byte_length) {
+UnicodeText& UnicodeText::UnsafeCopyUTF8(const char* buffer,
+                                         ptrdiff_t byte_length) {
   repr_.Copy(buffer, byte_length);
   return *this;
 }
 
 // ----- TakeOwnershipOf  -----
 
-UnicodeText& UnicodeText::TakeOwnershipOfUTF8(char* buffer, int byte_length,
-                                              int byte_capacity) {
+UnicodeText& UnicodeText::TakeOwnershipOfUTF8(char* buffer,
+                                              ptrdiff_t byte_length,
+                                              ptrdiff_t byte_capacity) {
   repr_.TakeOwnershipOf(buffer, byte_length, byte_capacity);
   if (!UniLib::IsInterchangeValid(buffer, byte_length)) {
     LOG(WARNING) << "UTF-8 buffer is not interchange-valid.";
@@ -242,15 +318,16 @@ UnicodeText& UnicodeText::TakeOwnershipOfUTF8(char* buffer, int byte_length,
 }
 
 UnicodeText& UnicodeText::UnsafeTakeOwnershipOfUTF8(char* buffer,
-                                                    int byte_length,
-                                                    int byte_capacity) {
+                                                    ptrdiff_t byte_length,
+                                                    ptrdiff_t byte_capacity) {
   repr_.TakeOwnershipOf(buffer, byte_length, byte_capacity);
   return *this;
 }
 
 // ----- PointTo -----
 
-UnicodeText& UnicodeText::PointToUTF8(const char* buffer, int byte_length) {
+UnicodeText& UnicodeText::PointToUTF8(const char* buffer,
+                                      ptrdiff_t byte_length) {
   if (UniLib::IsInterchangeValid(buffer, byte_length)) {
     repr_.PointTo(buffer, byte_length);
   } else {
@@ -262,7 +339,7 @@ UnicodeText& UnicodeText::PointToUTF8(const char* buffer, int byte_length) {
 }
 
 UnicodeText& UnicodeText::UnsafePointToUTF8(const char* buffer,
-                                            int byte_length) {
+                                            ptrdiff_t byte_length) {
   repr_.PointTo(buffer, byte_length);
   return *this;
 }
@@ -293,7 +370,7 @@ UnicodeText& UnicodeText::append(const const_iterator& first,
   return *this;
 }
 
-UnicodeText& UnicodeText::UnsafeAppendUTF8(const char* utf8, int len) {
+UnicodeText& UnicodeText::UnsafeAppendUTF8(const char* utf8, ptrdiff_t len) {
   repr_.append(utf8, len);
   return *this;
 }
@@ -312,31 +389,253 @@ UnicodeText::const_iterator UnicodeText::find(const UnicodeText& look) const {
   return UnsafeFind(look, begin());
 }
 
+namespace {
+
+// Finds one needle in valid UTF-8. Since UTF-8 is self-synchronizing, a
+// match of valid UTF-8 in valid UTF-8 always starts and ends on codepoint
+// boundaries, so this is plain byte search. Prepared once per needle, so
+// find_all() does not redo the setup for every match.
+//
+// Candidates are filtered on the first and last bytes of the needle, which
+// rejects most of them before the full comparison. That alone is O(n * m)
+// in the worst case, when most candidates pass the filter and then differ
+// late, as for "aaa...aba" in a run of 'a's, so the search moves to the
+// linear Two-Way algorithm once comparisons outweigh the bytes scanned.
+class UTF8Searcher {
+ public:
+  explicit UTF8Searcher(absl::string_view needle) : needle_(needle) {}
+
+  // Returns the offset of the first occurrence of the needle in "haystack"
+  // at or after "pos", or npos if there is none.
+  size_t Find(absl::string_view haystack, size_t pos);
+
+ private:
+  // Runs the filter until a match, the end, or until it compared more bytes
+  // than "budget" plus the bytes it scanned. Returns the match or npos, and
+  // sets *stop to the offset where it gave up, or npos if it did not.
+  size_t FindFiltered(absl::string_view haystack, size_t pos, size_t budget,
+                      size_t* stop) const;
+  size_t FindTwoWay(absl::string_view haystack, size_t pos);
+
+  // Computes the critical factorization of the needle for Two-Way.
+  void Factorize();
+
+  const absl::string_view needle_;
+  bool factorized_ = false;
+  // The needle is split into needle_[0, critical_pos_) and the rest.
+  size_t critical_pos_ = 0;
+  // The period of the needle, if periodic_, else the shift on a mismatch of
+  // the left part.
+  size_t period_ = 0;
+  bool periodic_ = false;
+};
+
+size_t UTF8Searcher::Find(absl::string_view haystack, size_t pos) {
+  if (pos > haystack.size() || needle_.size() > haystack.size() - pos)
+    return absl::string_view::npos;
+  if (needle_.empty())
+    return pos;
+  size_t stop;
+  // A few false candidates are cheaper to compare than to set up Two-Way.
+  const size_t found = FindFiltered(haystack, pos, 4 * needle_.size(), &stop);
+  if (stop == absl::string_view::npos)
+    return found;
+  return FindTwoWay(haystack, stop);
+}
+
+size_t UTF8Searcher::FindFiltered(absl::string_view haystack, size_t pos,
+                                  size_t budget, size_t* stop) const {
+  *stop = absl::string_view::npos;
+  const char* const begin = haystack.data();
+  const char* const start = begin + pos;
+  const char* p = start;
+  // The last position at which a match can start, plus one.
+  const char* const limit = begin + haystack.size() - needle_.size() + 1;
+  const char first = needle_.front();
+  const char last = needle_.back();
+  const size_t last_offset = needle_.size() - 1;
+  // Bytes compared after passing the filter.
+  size_t compared = 0;
+#ifdef __SSE2__
+  // Tests 16 candidates at once.
+  const __m128i first_bytes = _mm_set1_epi8(first);
+  const __m128i last_bytes = _mm_set1_epi8(last);
+  for (; limit - p >= 16; p += 16) {
+    const __m128i firsts = _mm_cmpeq_epi8(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), first_bytes);
+    const __m128i lasts = _mm_cmpeq_epi8(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + last_offset)),
+        last_bytes);
+    for (uint32_t mask = _mm_movemask_epi8(_mm_and_si128(firsts, lasts));
+         mask != 0; mask &= mask - 1) {
+      const char* candidate = p + absl::countr_zero(mask);
+      if (memcmp(candidate + 1, needle_.data() + 1, needle_.size() - 1) == 0)
+        return candidate - begin;
+      compared += needle_.size();
+    }
+    if (compared > budget + (p - start)) {
+      // Nothing matched before the next block.
+      *stop = p + 16 - begin;
+      return absl::string_view::npos;
+    }
+  }
+#endif  // __SSE2__
+  // memchr() finds the remaining candidates by their first byte.
+  while ((p = static_cast<const char*>(memchr(p, first, limit - p))) !=
+         nullptr) {
+    if (p[last_offset] == last) {
+      if (memcmp(p + 1, needle_.data() + 1, needle_.size() - 1) == 0)
+        return p - begin;
+      compared += needle_.size();
+    }
+    ++p;
+    if (compared > budget + (p - start)) {
+      *stop = p - begin;
+      return absl::string_view::npos;
+    }
+  }
+  return absl::string_view::npos;
+}
+
+void UTF8Searcher::Factorize() {
+  // The critical position is the later of the starts of the maximal
+  // suffixes for the byte order and for its reverse (Crochemore and
+  // Perrin, "Two-way string-matching", 1991). Positions are one past the
+  // start, so that 0 stands for the empty prefix.
+  const unsigned char* const x =
+      reinterpret_cast<const unsigned char*>(needle_.data());
+  const size_t m = needle_.size();
+  size_t suffix[2], period[2];
+  for (int reversed = 0; reversed < 2; ++reversed) {
+    size_t ms = 0;  // One past the start of the maximal suffix so far.
+    size_t j = 1, k = 1, p = 1;
+    while (j + k <= m) {
+      const unsigned char a = x[j + k - 1];
+      const unsigned char b = x[ms + k - 1];
+      if (reversed ? a > b : a < b) {
+        // The candidate suffix at j is smaller: skip it.
+        j += k;
+        k = 1;
+        p = j - ms;
+      } else if (a == b) {
+        if (k != p) {
+          ++k;
+        } else {
+          j += p;
+          k = 1;
+        }
+      } else {
+        // A larger suffix starts at j.
+        ms = j++;
+        k = p = 1;
+      }
+    }
+    suffix[reversed] = ms;
+    period[reversed] = p;
+  }
+  const int use = suffix[1] >= suffix[0] ? 1 : 0;
+  critical_pos_ = suffix[use];
+  period_ = period[use];
+  // The needle is periodic if its left part occurs again one period later.
+  periodic_ = critical_pos_ + period_ <= m &&
+              memcmp(x, x + period_, critical_pos_) == 0;
+  if (!periodic_)
+    period_ = std::max(critical_pos_, m - critical_pos_) + 1;
+  factorized_ = true;
+}
+
+size_t UTF8Searcher::FindTwoWay(absl::string_view haystack, size_t pos) {
+  if (!factorized_)
+    Factorize();
+  const char* const x = needle_.data();
+  const char* const y = haystack.data();
+  const size_t m = needle_.size();
+  const size_t n = haystack.size();
+  // Bytes of the needle's prefix known to match at the current position,
+  // after a shift by the period of a periodic needle.
+  size_t memory = 0;
+  for (size_t j = pos; j + m <= n;) {
+    // Matches the right part, left to right.
+    size_t i = std::max(critical_pos_, memory);
+    while (i < m && x[i] == y[j + i])
+      ++i;
+    if (i < m) {
+      j += i - critical_pos_ + 1;
+      memory = 0;
+      continue;
+    }
+    // Matches the left part, right to left.
+    i = critical_pos_;
+    while (i > memory && x[i - 1] == y[j + i - 1])
+      --i;
+    if (i <= memory)
+      return j;
+    j += period_;
+    memory = periodic_ ? m - period_ : 0;
+  }
+  return absl::string_view::npos;
+}
+
+}  // namespace
+
+static size_t FindUTF8(absl::string_view haystack, absl::string_view needle,
+                       size_t pos) {
+  return UTF8Searcher(needle).Find(haystack, pos);
+}
+
 UnicodeText::const_iterator UnicodeText::UnsafeFind(
     const UnicodeText& look, const_iterator start_pos) const {
   // Due to the magic of the UTF8 encoding, searching for a sequence of
   // letters is equivalent to substring search.
-  absl::string_view searching(utf8_data(), utf8_length());
-  absl::string_view look_piece(look.utf8_data(), look.utf8_length());
-  LOG(FATAL) << "Not implemented";
-  // StringPiece::size_type found =
-  //     searching.find(look_piece, start_pos.utf8_data() - utf8_data());
-  absl::string_view::size_type found = absl::string_view::npos;
+  const size_t found =
+      FindUTF8(UnicodeTextToStringView(*this), UnicodeTextToStringView(look),
+               start_pos.utf8_data() - utf8_data());
   if (found == absl::string_view::npos)
     return end();
+  // An empty "look" matches at end() too, which must not be dereferenced.
+  DCHECK(look.empty() || !UniLib::IsTrailByte(utf8_data()[found]));
   return const_iterator(utf8_data() + found);
 }
 
+UnicodeText::const_iterator UnicodeText::rfind(const UnicodeText& look,
+                                               const_iterator start_pos) const {
+  CHECK(start_pos.utf8_data() >= utf8_data()) << "Iterator out of range";
+  CHECK(start_pos.utf8_data() <= utf8_data() + utf8_length())
+      << "Iterator out of range";
+  const size_t found = UnicodeTextToStringView(*this).rfind(
+      UnicodeTextToStringView(look), start_pos.utf8_data() - utf8_data());
+  if (found == absl::string_view::npos)
+    return end();
+  return const_iterator(utf8_data() + found);
+}
+
+UnicodeText::const_iterator UnicodeText::rfind(const UnicodeText& look) const {
+  return rfind(look, end());
+}
+
+std::vector<UnicodeText::const_iterator> UnicodeText::find_all(
+    const UnicodeText& look) const {
+  std::vector<const_iterator> result;
+  if (look.empty())
+    return result;
+  const absl::string_view searching = UnicodeTextToStringView(*this);
+  UTF8Searcher searcher(UnicodeTextToStringView(look));
+  for (size_t found = searcher.Find(searching, 0);
+       found != absl::string_view::npos;
+       found = searcher.Find(searching, found + look.utf8_length())) {
+    result.push_back(const_iterator(utf8_data() + found));
+  }
+  return result;
+}
+
 bool UnicodeText::HasReplacementChar() const {
   // Equivalent to:
   //   UnicodeText replacement_char;
   //   replacement_char.push_back(0xFFFD);
   //   return find(replacement_char) != end();
-  absl::string_view searching(utf8_data(), utf8_length());
-  absl::string_view looking_for("\xEF\xBF\xBD", 3);
-  LOG(FATAL) << "Not implemented";
-  // return searching.find(looking_for) != StringPiece::npos;
-  return false;
+  return FindUTF8(UnicodeTextToStringView(*this),
+                  absl::string_view("\xEF\xBF\xBD", 3),
+                  0) != absl::string_view::npos;
 }
 
 // ----- other methods -----
@@ -348,6 +647,9 @@ void UnicodeText::clear() { repr_.clear(); }
 UnicodeText::~UnicodeText() {}
 
 void UnicodeText::push_back(char32 c) {
+  // Appends exactly one codepoint, so a known count stays known.
+  const ptrdiff_t count =
+      repr_.codepoint_count_.load(std::memory_order_relaxed);
   if (UniLib::IsValidCodepoint(c)) {
     char buf[UTFmax];
     int len = runetochar(buf, &c);
@@ -362,10 +664,18 @@ void UnicodeText::push_back(char32 c) {
     LOG(WARNING) << absl::StrFormat("Illegal Unicode value: 0x%x", c);
     repr_.append(" ", 1);
   }
+  if (count >= 0) {
+    repr_.codepoint_count_.store(count + 1, std::memory_order_relaxed);
+  }
 }
 
-int UnicodeText::size() const {
-  return CodepointCount(repr_.data_, repr_.size_);
+ptrdiff_t UnicodeText::size() const {
+  ptrdiff_t count = repr_.codepoint_count_.load(std::memory_order_relaxed);
+  if (count < 0) {
+    count = CodepointCount(repr_.data_, repr_.size_);
+    repr_.codepoint_count_.store(count, std::memory_order_relaxed);
+  }
+  return count;
 }
 
 bool operator==(const UnicodeText& lhs, const UnicodeText& rhs) {
@@ -482,7 +792,7 @@ int UnicodeText::const_iterator::utf8_length() const {
 UnicodeText::const_iterator UnicodeText::MakeIterator(const char* p) const {
   CHECK(p != nullptr) << "ptr is null";
   const char* start = utf8_data();
-  int len = utf8_length();
+  ptrdiff_t len = utf8_length();
   const char* end = start + len;
   CHECK(p >= start) << "ptr out of range";
   CHECK(p <= end) << "ptr out of range";
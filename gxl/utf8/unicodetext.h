@@ -19,9 +19,11 @@
 
 #include <stddef.h>  // for NULL, ptrdiff_t
 
+#include <atomic>    // for std::atomic
 #include <iterator>  // for bidirectional_iterator_tag, etc
 #include <string>    // for std::string
 #include <utility>   // for std::pair
+#include <vector>    // for std::vector
 
 #include "absl/strings/string_view.h"
 #include "gxl/base/types.h"
@@ -101,6 +103,15 @@
 // was an alias. The assignment operator ("x = y;") also produces an
 // owner unless x and y are the same object and y is an alias.
 //
+// The move constructor and the move assignment operator take over the
+// buffer of their source without copying it, so the result is an owner
+// if the source was an owner and an alias if it was an alias. The
+// source is left empty.
+//
+// An owner keeps texts of up to kInlineCapacity bytes in a buffer
+// inside the object, so short texts never allocate. Moving such a text
+// copies those bytes.
+//
 // Aliases should be used with care. If the source from which an alias
 // was created is freed, or if the contents are changed, while the
 // alias is still in use, fatal errors could result. But it can be
@@ -122,14 +133,17 @@ class UnicodeText {
   typedef char32 value_type;
 
   // Constructors. These always produce owners.
-  UnicodeText();                        // Create an empty text.
-  UnicodeText(const UnicodeText& src);  // copy constructor
+  UnicodeText();                            // Create an empty text.
+  UnicodeText(const UnicodeText& src);      // copy constructor
+  UnicodeText(UnicodeText&& src) noexcept;  // move constructor
   // Construct a substring (copies the data).
   UnicodeText(const const_iterator& first, const const_iterator& last);
 
   // Assignment operator. This copies the data and produces an owner
   // unless this == &src, e.g., "x = x;", which is a no-op.
   UnicodeText& operator=(const UnicodeText& src);
+  // Move assignment. This takes over src's data; see above.
+  UnicodeText& operator=(UnicodeText&& src) noexcept;
 
   // x.Copy(y) copies the data from y into x.
   UnicodeText& Copy(const UnicodeText& src);
@@ -171,7 +185,9 @@ class UnicodeText {
   // An optimization of append(source.begin(), source.end()).
   UnicodeText& append(const UnicodeText& source);
 
-  int size() const;  // the number of Unicode characters (codepoints)
+  // The number of Unicode characters (codepoints). The count is cached
+  // until the text is changed, so repeated calls are O(1).
+  ptrdiff_t size() const;
 
   friend bool operator==(const UnicodeText& lhs, const UnicodeText& rhs);
   friend bool operator!=(const UnicodeText& lhs, const UnicodeText& rhs);
@@ -286,6 +302,14 @@ class UnicodeText {
   const_iterator find(const UnicodeText& look, const_iterator start_pos) const;
   // Equivalent to find(look, begin())
   const_iterator find(const UnicodeText& look) const;
+  // Returns the beginning of the last occurrence of "look" that begins
+  // at or before start_pos, or end() if not found.
+  const_iterator rfind(const UnicodeText& look, const_iterator start_pos) const;
+  // Equivalent to rfind(look, end())
+  const_iterator rfind(const UnicodeText& look) const;
+  // Returns the beginnings of the non-overlapping occurrences of "look",
+  // in order. Returns nothing if look is empty.
+  std::vector<const_iterator> find_all(const UnicodeText& look) const;
 
   // Returns whether this contains the character U+FFFD.  This can
   // occur, for example, if the input to Encodings::Decode() had byte
@@ -297,8 +321,11 @@ class UnicodeText {
   // Return the data, length, and capacity of UTF-8-encoded version of
   // the text. Length and capacity are measured in bytes.
   const char* utf8_data() const { return repr_.data_; }
-  int utf8_length() const { return repr_.size_; }
-  int utf8_capacity() const { return repr_.capacity_; }
+  ptrdiff_t utf8_length() const { return repr_.size_; }
+  ptrdiff_t utf8_capacity() const { return repr_.capacity_; }
+
+  // The size of the buffer within each UnicodeText for short texts.
+  static constexpr int kInlineCapacity = 24;
 
   // Return the UTF-8 data as a string.
   static std::string UTF8Substring(const const_iterator& first,
@@ -312,18 +339,18 @@ class UnicodeText {
   // is replaced with a space.
 
   // x.CopyUTF8(buf, len) copies buf into x.
-  UnicodeText& CopyUTF8(const char* utf8_buffer, int byte_length);
+  UnicodeText& CopyUTF8(const char* utf8_buffer, ptrdiff_t byte_length);
 
   // x.TakeOwnershipOfUTF8(buf, len, capacity). x takes ownership of
   // buf. buf is not copied.
-  UnicodeText& TakeOwnershipOfUTF8(char* utf8_buffer, int byte_length,
-                                   int byte_capacity);
+  UnicodeText& TakeOwnershipOfUTF8(char* utf8_buffer, ptrdiff_t byte_length,
+                                   ptrdiff_t byte_capacity);
 
   // x.PointToUTF8(buf,len) changes x so that it points to buf
   // ("becomes an alias"). It does not take ownership or copy buf.
   // If the buffer is not valid, this has the same effect as
   // CopyUTF8(utf8_buffer, byte_length).
-  UnicodeText& PointToUTF8(const char* utf8_buffer, int byte_length);
+  UnicodeText& PointToUTF8(const char* utf8_buffer, ptrdiff_t byte_length);
 
   // Occasionally it is necessary to use functions that operate on the
   // pointer returned by utf8_data(). MakeIterator(p) provides a way
@@ -340,29 +367,49 @@ class UnicodeText {
 
   class Repr {  // A byte-string.
    public:
-    char* data_;
-    int size_;
-    int capacity_;
+    char* data_;  // Points to inline_ for short owned texts.
+    ptrdiff_t size_;
+    ptrdiff_t capacity_;
     bool ours_;  // Do we own data_?
-
-    Repr() : data_(nullptr), size_(0), capacity_(0), ours_(true) {}
-    ~Repr() {
-      if (ours_)
-        delete[] data_;
-    }
+    // The number of codepoints in data_, or -1 if not yet counted. Every
+    // method that changes the data resets it; code that then writes data_
+    // or size_ directly must leave it reset.
+    mutable std::atomic<ptrdiff_t> codepoint_count_;
+
+    Repr()
+        : data_(nullptr),
+          size_(0),
+          capacity_(0),
+          ours_(true),
+          codepoint_count_(0) {}
+    ~Repr() { FreeData(); }
 
     void clear();
-    void reserve(int capacity);
-    void resize(int size);
-
-    void append(const char* bytes, int byte_length);
-    void Copy(const char* data, int size);
-    void TakeOwnershipOf(char* data, int size, int capacity);
-    void PointTo(const char* data, int size);
+    void reserve(ptrdiff_t capacity);
+    void resize(ptrdiff_t size);
+
+    void append(const char* bytes, ptrdiff_t byte_length);
+    void Copy(const char* data, ptrdiff_t size);
+    void TakeOwnershipOf(char* data, ptrdiff_t size, ptrdiff_t capacity);
+    void PointTo(const char* data, ptrdiff_t size);
+    // Takes over src's data and leaves src empty.
+    void Move(Repr* src);
+
+    void InvalidateCodepointCount() {
+      codepoint_count_.store(-1, std::memory_order_relaxed);
+    }
 
     std::string DebugString() const;
 
    private:
+    // Frees data_ if we own it and it is not inline_.
+    void FreeData() {
+      if (ours_ && data_ != inline_)
+        delete[] data_;
+    }
+
+    char inline_[kInlineCapacity];
+
     Repr& operator=(const Repr&);
     Repr(const Repr& other);
   };
@@ -375,11 +422,13 @@ class UnicodeText {
   // It is an error to call these methods with UTF-8 data that
   // is not interchange-valid.
   //
-  UnicodeText& UnsafeCopyUTF8(const char* utf8_buffer, int byte_length);
-  UnicodeText& UnsafeTakeOwnershipOfUTF8(char* utf8_buffer, int byte_length,
-                                         int byte_capacity);
-  UnicodeText& UnsafePointToUTF8(const char* utf8_buffer, int byte_length);
-  UnicodeText& UnsafeAppendUTF8(const char* utf8_buffer, int byte_length);
+  UnicodeText& UnsafeCopyUTF8(const char* utf8_buffer, ptrdiff_t byte_length);
+  UnicodeText& UnsafeTakeOwnershipOfUTF8(char* utf8_buffer,
+                                         ptrdiff_t byte_length,
+                                         ptrdiff_t byte_capacity);
+  UnicodeText& UnsafePointToUTF8(const char* utf8_buffer,
+                                 ptrdiff_t byte_length);
+  UnicodeText& UnsafeAppendUTF8(const char* utf8_buffer, ptrdiff_t byte_length);
   const_iterator UnsafeFind(const UnicodeText& look,
                             const_iterator start_pos) const;
 };
@@ -411,10 +460,11 @@ inline bool UnicodeTextRangeIsEmpty(const UnicodeTextRange& r) {
 // multibyte sequence in the UTF-8 data.
 //
 inline UnicodeText MakeUnicodeTextAcceptingOwnership(char* utf8_buffer,
-                                                     int byte_length,
-                                                     int byte_capacity) {
-  return UnicodeText().TakeOwnershipOfUTF8(utf8_buffer, byte_length,
-                                           byte_capacity);
+                                                     ptrdiff_t byte_length,
+                                                     ptrdiff_t byte_capacity) {
+  UnicodeText t;
+  t.TakeOwnershipOfUTF8(utf8_buffer, byte_length, byte_capacity);
+  return t;
 }
 
 // A factory function for creating a UnicodeText from a buffer of
@@ -422,8 +472,10 @@ inline UnicodeText MakeUnicodeTextAcceptingOwnership(char* utf8_buffer,
 // buffer. (It is an "alias.")
 //
 inline UnicodeText MakeUnicodeTextWithoutAcceptingOwnership(
-    const char* utf8_buffer, int byte_length) {
-  return UnicodeText().PointToUTF8(utf8_buffer, byte_length);
+    const char* utf8_buffer, ptrdiff_t byte_length) {
+  UnicodeText t;
+  t.PointToUTF8(utf8_buffer, byte_length);
+  return t;
 }
 
 // Create a UnicodeText from a UTF-8 string or buffer.
@@ -443,7 +495,7 @@ inline UnicodeText MakeUnicodeTextWithoutAcceptingOwnership(
 // made (as if do_copy were true) and coerced to valid UTF-8 by
 // replacing each invalid byte with a space.
 //
-inline UnicodeText UTF8ToUnicodeText(const char* utf8_buf, int len,
+inline UnicodeText UTF8ToUnicodeText(const char* utf8_buf, ptrdiff_t len,
                                      bool do_copy) {
   UnicodeText t;
   if (do_copy) {
@@ -459,7 +511,7 @@ inline UnicodeText UTF8ToUnicodeText(const std::string& utf_string,
   return UTF8ToUnicodeText(utf_string.data(), utf_string.size(), do_copy);
 }
 
-inline UnicodeText UTF8ToUnicodeText(const char* utf8_buf, int len) {
+inline UnicodeText UTF8ToUnicodeText(const char* utf8_buf, ptrdiff_t len) {
   return UTF8ToUnicodeText(utf8_buf, len, true);
 }
 inline UnicodeText UTF8ToUnicodeText(const std::string& utf8_string) {
@@ -0,0 +1,130 @@
+/**
+ * Copyright 2010 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Compares gxl/utf8 with the routines of third_party/utf.
+//
+// The find benchmarks search a text of mostly Latin and CJK codepoints for
+// a needle that occurs only at its end, or a run of one letter for a needle
+// differing near its end. The argument is the needle length in codepoints.
+//
+// The classification benchmarks classify and lowercase the codepoints of a
+// mixed-script text.
+
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "gxl/utf8/unicodetext.h"
+#include "gxl/utf8/unilib_runetype.h"
+#include "third_party/utf/utf.h"
+
+namespace {
+
+constexpr int kTextCodepoints = 1 << 20;
+
+// Returns a text of about kTextCodepoints codepoints followed by a needle of
+// "needle_codepoints" codepoints, and sets *needle to the needle.
+std::string MakeText(int needle_codepoints, std::string* needle) {
+  const char* const kFiller[] = {"abc", "de ", "\xE4\xBA\x8C",
+                                 "\xC7\x80", "xyz"};
+  std::string text;
+  for (int i = 0; i < kTextCodepoints / 3; ++i) {
+    text += kFiller[i % 5];
+  }
+  needle->clear();
+  for (int i = 0; i < needle_codepoints; ++i) {
+    // Shares its prefix with the filler to defeat first-byte filtering.
+    *needle += i == needle_codepoints - 1 ? "\xF0\x9D\x84\x9E" : kFiller[i % 5];
+  }
+  return text + *needle;
+}
+
+void BM_UnicodeTextFind(benchmark::State& state) {
+  std::string needle_utf8;
+  const std::string text_utf8 = MakeText(state.range(0), &needle_utf8);
+  const UnicodeText text = UTF8ToUnicodeText(text_utf8, false);
+  const UnicodeText needle = UTF8ToUnicodeText(needle_utf8, false);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(text.find(needle));
+  }
+  state.SetBytesProcessed(state.iterations() * text_utf8.size());
+}
+BENCHMARK(BM_UnicodeTextFind)->Arg(1)->Arg(4)->Arg(16)->Arg(64)->Arg(256);
+
+// The worst case of byte filtering: every position passes the filter on
+// the first and last bytes, and the needle differs one byte before its end.
+void BM_UnicodeTextFindPeriodic(benchmark::State& state) {
+  std::string needle_utf8(state.range(0), 'a');
+  needle_utf8[needle_utf8.size() - 2] = 'b';
+  const std::string text_utf8 =
+      std::string(kTextCodepoints, 'a') + needle_utf8;
+  const UnicodeText text = UTF8ToUnicodeText(text_utf8, false);
+  const UnicodeText needle = UTF8ToUnicodeText(needle_utf8, false);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(text.find(needle));
+  }
+  state.SetBytesProcessed(state.iterations() * text_utf8.size());
+}
+BENCHMARK(BM_UnicodeTextFindPeriodic)->Arg(4)->Arg(64)->Arg(1024);
+
+void BM_Utfutf(benchmark::State& state) {
+  std::string needle;
+  const std::string text = MakeText(state.range(0), &needle);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(utfutf(text.c_str(), needle.c_str()));
+  }
+  state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(BM_Utfutf)->Arg(1)->Arg(4)->Arg(16)->Arg(64)->Arg(256);
+
+std::vector<char32> MakeCodepoints() {
+  const char32 kSamples[] = {'a',    'Z',    ' ',    '7',    0xE9,   0x3A3,
+                             0x3C9,  0x416,  0x5D0,  0x627,  0x915,  0x3042,
+                             0x4E8C, 0xAC00, 0xFF21, 0x1D11E};
+  std::vector<char32> codepoints;
+  for (int i = 0; i < 4096; ++i) {
+    codepoints.push_back(kSamples[(i * 7) % arraysize(kSamples)]);
+  }
+  return codepoints;
+}
+
+void BM_ThirdPartyRuneType(benchmark::State& state) {
+  const std::vector<char32> codepoints = MakeCodepoints();
+  for (auto _ : state) {
+    int letters = 0;
+    for (char32 c : codepoints) {
+      letters += isalpharune(c) && tolowerrune(c) != c;
+    }
+    benchmark::DoNotOptimize(letters);
+  }
+  state.SetItemsProcessed(state.iterations() * codepoints.size());
+}
+BENCHMARK(BM_ThirdPartyRuneType);
+
+void BM_UniLibRuneType(benchmark::State& state) {
+  const std::vector<char32> codepoints = MakeCodepoints();
+  for (auto _ : state) {
+    int letters = 0;
+    for (char32 c : codepoints) {
+      letters += UniLib::IsAlpha(c) && UniLib::ToLower(c) != c;
+    }
+    benchmark::DoNotOptimize(letters);
+  }
+  state.SetItemsProcessed(state.iterations() * codepoints.size());
+}
+BENCHMARK(BM_UniLibRuneType);
+
+}  // namespace
@@ -16,11 +16,17 @@
 
 #include "gxl/utf8/unicodetext.h"
 
+#include <cstddef>
+#include <cstdint>
 #include <iterator>
 #include <set>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "gxl/utf8/unilib.h"
+#include "gxl/utf8/unilib_runetype.h"
 #include "third_party/utf/utf.h"
 
 namespace {
@@ -101,6 +107,42 @@ TEST(UnicodeTextTest, Ownership) {
   }
 }
 
+TEST(UnicodeTextTest, Move) {
+  const std::string src(100, 'x');
+  {
+    UnicodeText owner = UTF8ToUnicodeText(src);
+    const char* data = owner.utf8_data();
+    UnicodeText moved(std::move(owner));
+    EXPECT_EQ(moved.utf8_data(), data);  // The buffer was not copied.
+    EXPECT_EQ(moved.size(), 100);
+    EXPECT_TRUE(owner.empty());
+
+    owner = std::move(moved);
+    EXPECT_EQ(owner.utf8_data(), data);
+    EXPECT_TRUE(moved.empty());
+  }
+
+  {
+    UnicodeText alias = UTF8ToUnicodeText(src, false);
+    UnicodeText moved = std::move(alias);
+    EXPECT_EQ(moved.utf8_data(), src.data());  // Still an alias.
+  }
+
+  {
+    UnicodeText short_text = UTF8ToUnicodeText("\u304A\u00B0\u106B");
+    EXPECT_EQ(short_text.utf8_capacity(), UnicodeText::kInlineCapacity);
+    std::vector<UnicodeText> texts;
+    texts.push_back(std::move(short_text));
+    EXPECT_TRUE(short_text.empty());
+    EXPECT_EQ(UnicodeTextToUTF8(texts[0]), "\u304A\u00B0\u106B");
+
+    // Growing past the inline buffer moves the text to the heap.
+    texts[0].append(UTF8ToUnicodeText(src));
+    EXPECT_GT(texts[0].utf8_capacity(), UnicodeText::kInlineCapacity);
+    EXPECT_EQ(texts[0].size(), 103);
+  }
+}
+
 class IteratorTest : public UnicodeTextTest {};
 
 TEST_F(IteratorTest, Iterates) {
@@ -198,6 +240,37 @@ TEST_F(IteratorTest, Distance) {
   EXPECT_EQ(0, distance(iter, text_.end()));
 }
 
+TEST_F(IteratorTest, DistanceLongText) {
+  // Long enough to cover whole blocks and a tail of the vectorized count.
+  UnicodeText long_text;
+  for (int i = 0; i < 50; ++i) {
+    long_text.append(text_);
+    long_text.push_back('a');
+  }
+  EXPECT_EQ(long_text.utf8_length(), 50 * 14);
+  EXPECT_EQ(long_text.size(), 50 * 6);
+  EXPECT_EQ(distance(long_text.begin(), long_text.end()), 50 * 6);
+  UnicodeText::const_iterator iter = long_text.begin();
+  std::advance(iter, 97);
+  EXPECT_EQ(distance(iter, long_text.end()), 50 * 6 - 97);
+}
+
+TEST_F(IteratorTest, SizeAfterMutation) {
+  EXPECT_EQ(text_.size(), 5);
+  text_.push_back(0x4E8C);
+  EXPECT_EQ(text_.size(), 6);
+  const UnicodeText other(text_);
+  text_.append(other.begin(), other.end());
+  EXPECT_EQ(text_.size(), 12);
+  UnicodeText copy(text_);
+  EXPECT_EQ(copy.size(), 12);
+  const std::string ascii = "abc";
+  copy.PointToUTF8(ascii.data(), ascii.size());
+  EXPECT_EQ(copy.size(), 3);
+  copy.clear();
+  EXPECT_EQ(copy.size(), 0);
+}
+
 TEST_F(IteratorTest, Encode) {
   const std::string utf8 =
       "\xC7\x80"
@@ -303,12 +376,29 @@ TEST(UnicodeTextTest, InterchangeValidity) {
   EXPECT_EQ(*a.begin(), 0x20);
 }
 
+TEST(UniLibTest, RuneTypeMatchesThirdPartyUtf) {
+  for (char32 c = -1; c <= Runemax + 1; ++c) {
+    ASSERT_EQ(UniLib::IsSpace(c), isspacerune(c) != 0) << c;
+    ASSERT_EQ(UniLib::IsDigit(c), isdigitrune(c) != 0) << c;
+    ASSERT_EQ(UniLib::IsAlpha(c), isalpharune(c) != 0) << c;
+    ASSERT_EQ(UniLib::IsUpper(c), isupperrune(c) != 0) << c;
+    ASSERT_EQ(UniLib::IsLower(c), islowerrune(c) != 0) << c;
+    ASSERT_EQ(UniLib::IsTitle(c), istitlerune(c) != 0) << c;
+    ASSERT_EQ(UniLib::IsIdeographic(c), isideographicrune(c) != 0) << c;
+    ASSERT_EQ(UniLib::ToUpper(c), toupperrune(c)) << c;
+    ASSERT_EQ(UniLib::ToLower(c), tolowerrune(c)) << c;
+    ASSERT_EQ(UniLib::ToTitle(c), totitlerune(c)) << c;
+  }
+  EXPECT_FALSE(UniLib::IsAlpha(0x7FFFFFFF));
+  EXPECT_EQ(UniLib::ToUpper(0x7FFFFFFF), 0x7FFFFFFF);
+}
+
 class SubstringSearchTest : public UnicodeTextTest {};
 
-#if 0
 TEST_F(SubstringSearchTest, FindEmpty) {
   EXPECT_TRUE(text_.find(empty_text_) == text_.begin());
   EXPECT_TRUE(empty_text_.find(text_) == empty_text_.end());
+  EXPECT_TRUE(text_.find(empty_text_, text_.end()) == text_.end());
 }
 
 TEST_F(SubstringSearchTest, Find) {
@@ -362,6 +452,123 @@ TEST_F(SubstringSearchTest, HasConversionError) {
   adj_uni.append(&adj[0], adj + arraysize(adj));
   EXPECT_TRUE(adj_uni.HasReplacementChar());
 }
-#endif
+
+TEST_F(SubstringSearchTest, RFind) {
+  UnicodeText twice(text_);
+  twice.append(text_);
+  UnicodeText::const_iterator second_copy = twice.begin();
+  std::advance(second_copy, 5);
+
+  const char32 text[] = {0x1C0, 0x4E8C, 0xD7DB, 0x34, 0x1D11E};
+  UnicodeText middle;
+  middle.append(&text[1], &text[3]);
+  UnicodeText::const_iterator found = twice.rfind(middle);
+  EXPECT_EQ(distance(twice.begin(), found), 6);
+  found = twice.rfind(middle, second_copy);
+  EXPECT_EQ(distance(twice.begin(), found), 1);
+  EXPECT_TRUE(twice.rfind(middle, twice.begin()) == twice.end());
+  EXPECT_TRUE(twice.rfind(empty_text_) == twice.end());
+}
+
+TEST_F(SubstringSearchTest, FindAll) {
+  UnicodeText haystack;
+  for (int i = 0; i < 3; ++i) {
+    haystack.append(text_);
+    haystack.push_back(0xFFFD);
+  }
+  std::vector<UnicodeText::const_iterator> found = haystack.find_all(text_);
+  ASSERT_EQ(found.size(), 3);
+  EXPECT_EQ(distance(haystack.begin(), found[0]), 0);
+  EXPECT_EQ(distance(haystack.begin(), found[1]), 6);
+  EXPECT_EQ(distance(haystack.begin(), found[2]), 12);
+  EXPECT_TRUE(haystack.find_all(empty_text_).empty());
+
+  // Exercises a needle of several hundred bytes.
+  UnicodeText needle;
+  for (int i = 0; i < 25; ++i) {
+    needle.append(text_);
+  }
+  UnicodeText long_haystack(haystack);
+  long_haystack.append(needle);
+  long_haystack.append(haystack);
+  long_haystack.append(needle);
+  found = long_haystack.find_all(needle);
+  ASSERT_EQ(found.size(), 2);
+  EXPECT_EQ(distance(long_haystack.begin(), found[0]), 18);
+  EXPECT_EQ(distance(long_haystack.begin(), found[1]), 161);
+  EXPECT_TRUE(haystack.find(needle) == haystack.end());
+}
+
+// Checks find() and find_all() against std::string::find().
+void ExpectFindsLikeString(const std::string& haystack,
+                           const std::string& needle) {
+  const UnicodeText text = UTF8ToUnicodeText(haystack, false);
+  const UnicodeText look = UTF8ToUnicodeText(needle, false);
+  const size_t expected = haystack.find(needle);
+  const UnicodeText::const_iterator found = text.find(look);
+  if (expected == std::string::npos) {
+    EXPECT_TRUE(found == text.end()) << needle << " in " << haystack;
+  } else {
+    EXPECT_EQ(found.utf8_data() - text.utf8_data(), expected)
+        << needle << " in " << haystack;
+  }
+  std::vector<size_t> expected_all;
+  for (size_t pos = haystack.find(needle); pos != std::string::npos;
+       pos = haystack.find(needle, pos + needle.size())) {
+    expected_all.push_back(pos);
+  }
+  std::vector<size_t> all;
+  for (const UnicodeText::const_iterator it : text.find_all(look)) {
+    all.push_back(it.utf8_data() - text.utf8_data());
+  }
+  EXPECT_EQ(all, expected_all) << needle << " in " << haystack;
+}
+
+TEST_F(SubstringSearchTest, MatchesStringFind) {
+  // Few distinct bytes make the first and last bytes of the needle common,
+  // so that the search leaves the byte filter for Two-Way.
+  uint32_t state = 1;
+  const auto random = [&state](uint32_t n) {
+    state = state * 1103515245 + 12345;
+    return (state >> 16) % n;
+  };
+  const char* const kPieces[] = {"a", "b", "\xC3\xA9"};
+  for (int round = 0; round < 200; ++round) {
+    const int alphabet = 2 + random(2);
+    std::string haystack;
+    const int haystack_size = random(2000);
+    for (int i = 0; i < haystack_size; ++i) {
+      haystack += kPieces[random(10) == 0 ? random(alphabet) : 0];
+    }
+    std::string needle;
+    const int needle_size = 1 + random(round % 2 == 0 ? 20 : 400);
+    for (int i = 0; i < needle_size; ++i) {
+      needle += kPieces[random(10) == 0 ? random(alphabet) : 0];
+    }
+    ExpectFindsLikeString(haystack, needle);
+    if (haystack.size() > 10) {
+      // Also a needle that occurs.
+      const size_t start = random(haystack.size() / 2);
+      size_t end = start + 1 + random(haystack.size() - start);
+      // Cuts on codepoint boundaries.
+      const auto is_trail_byte = [&haystack](size_t i) {
+        return (haystack[i] & 0xC0) == 0x80;
+      };
+      while (end < haystack.size() && is_trail_byte(end)) {
+        ++end;
+      }
+      if (!is_trail_byte(start)) {
+        ExpectFindsLikeString(haystack, haystack.substr(start, end - start));
+      }
+    }
+  }
+
+  // The worst cases of the byte filter, for short and long needles.
+  const std::string run(100000, 'a');
+  ExpectFindsLikeString(run, std::string(99, 'a') + "b");
+  ExpectFindsLikeString(run + "b", std::string(99, 'a') + "b");
+  ExpectFindsLikeString(run + "b", std::string(999, 'a') + "b");
+  ExpectFindsLikeString(run, std::string(999, 'a'));
+}
 
 }  // namespace
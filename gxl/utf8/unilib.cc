@@ -18,6 +18,9 @@
 
 #include "gxl/utf8/unilib.h"
 
+#include <algorithm>
+#include <cstddef>
+
 #include "gxl/base/types.h"
 #include "third_party/utf/utf.h"
 
@@ -36,12 +39,15 @@ bool IsInterchangeValid(char32 c) {
            (c >= 0xFDD0 && c <= 0xFDEF) || (c & 0xFFFE) == 0xFFFE);
 }
 
-int SpanInterchangeValid(const char* begin, int byte_length) {
+ptrdiff_t SpanInterchangeValid(const char* begin, ptrdiff_t byte_length) {
   char32 rune;
   const char* p = begin;
   const char* end = begin + byte_length;
   while (p < end) {
-    int bytes_consumed = charntorune(&rune, p, end - p);
+    // charntorune takes an int length but never reads more than UTFmax
+    // bytes.
+    int bytes_consumed =
+        charntorune(&rune, p, std::min<ptrdiff_t>(end - p, UTFmax));
     // We want to accept Runeerror == U+FFFD as a valid char, but it is used
     // by chartorune to indicate error. Luckily, the real codepoint is size 3
     // while errors return bytes_consumed <= 1.
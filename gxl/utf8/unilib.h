@@ -31,6 +31,7 @@
 #ifndef GXL_UTF8_UNILIB_H_
 #define GXL_UTF8_UNILIB_H_
 
+#include <cstddef>
 #include <string>
 
 #include "gxl/base/types.h"
@@ -43,8 +44,8 @@ namespace UniLib {
 
 // Returns the length in bytes of the prefix of src that is all
 //  interchange valid UTF-8
-int SpanInterchangeValid(const char* src, int byte_length);
-inline int SpanInterchangeValid(const std::string& src) {
+ptrdiff_t SpanInterchangeValid(const char* src, ptrdiff_t byte_length);
+inline ptrdiff_t SpanInterchangeValid(const std::string& src) {
   return SpanInterchangeValid(src.data(), src.size());
 }
 
@@ -52,7 +53,7 @@ inline int SpanInterchangeValid(const std::string& src) {
 // "Interchange valid" is a stronger than structurally valid --
 // no C0 or C1 control codes (other than CR LF HT FF) and no non-characters.
 bool IsInterchangeValid(char32 codepoint);
-inline bool IsInterchangeValid(const char* src, int byte_length) {
+inline bool IsInterchangeValid(const char* src, ptrdiff_t byte_length) {
   return (byte_length == SpanInterchangeValid(src, byte_length));
 }
 inline bool IsInterchangeValid(const std::string& src) {
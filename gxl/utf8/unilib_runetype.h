@@ -0,0 +1,129 @@
+/**
+ * Copyright 2010 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Codepoint classification and case mapping by table lookup.
+//
+// These return the same results as isalpharune(), toupperrune() and the
+// other routines of third_party/utf, whose range tables they are
+// generated from, but take constant time: each codepoint's 256-codepoint
+// page selects a block, and the block holds the index of the codepoint's
+// properties. Codepoints outside [0, 0x10FFFF] have no properties and map
+// to themselves.
+
+#ifndef GXL_UTF8_UNILIB_RUNETYPE_H_
+#define GXL_UTF8_UNILIB_RUNETYPE_H_
+
+#include <cstdint>
+
+#include "gxl/base/types.h"
+
+namespace UniLib {
+
+namespace internal {
+
+// Flags of RuneInfo.
+enum RuneFlag : uint8_t {
+  kRuneSpace = 1 << 0,
+  kRuneDigit = 1 << 1,
+  kRuneAlpha = 1 << 2,
+  kRuneUpper = 1 << 3,
+  kRuneLower = 1 << 4,
+  kRuneTitle = 1 << 5,
+  kRuneIdeographic = 1 << 6,
+};
+
+// The properties shared by a set of codepoints. Case mappings are stored as
+// offsets so that runs of letters share one entry.
+struct RuneInfo {
+  uint8_t flags;
+  int32_t upper_delta;
+  int32_t lower_delta;
+  int32_t title_delta;
+};
+
+// Defined in unilib_runetype_tables.cc, which unilib_runetype_gen
+// generates. kRunePageBlocks has one more entry than there are pages; it
+// selects a block of codepoints without properties, for codepoints out of
+// range.
+constexpr int kRunePageBits = 8;
+constexpr uint32_t kRuneNumPages = 0x110000 >> kRunePageBits;
+extern const uint8_t kRunePageBlocks[kRuneNumPages + 1];
+extern const uint8_t kRuneBlockInfos[][1 << kRunePageBits];
+extern const RuneInfo kRuneInfos[];
+
+inline const RuneInfo& GetRuneInfo(char32 c) {
+  const uint32_t u = static_cast<uint32_t>(c);
+  uint32_t page = u >> kRunePageBits;
+  page = page < kRuneNumPages ? page : kRuneNumPages;  // A cmov, not a jump.
+  return kRuneInfos[kRuneBlockInfos[kRunePageBlocks[page]]
+                                   [u & ((1 << kRunePageBits) - 1)]];
+}
+
+}  // namespace internal
+
+// Same as isspacerune().
+inline bool IsSpace(char32 c) {
+  return internal::GetRuneInfo(c).flags & internal::kRuneSpace;
+}
+
+// Same as isdigitrune().
+inline bool IsDigit(char32 c) {
+  return internal::GetRuneInfo(c).flags & internal::kRuneDigit;
+}
+
+// Same as isalpharune().
+inline bool IsAlpha(char32 c) {
+  return internal::GetRuneInfo(c).flags & internal::kRuneAlpha;
+}
+
+// Same as isupperrune().
+inline bool IsUpper(char32 c) {
+  return internal::GetRuneInfo(c).flags & internal::kRuneUpper;
+}
+
+// Same as islowerrune().
+inline bool IsLower(char32 c) {
+  return internal::GetRuneInfo(c).flags & internal::kRuneLower;
+}
+
+// Same as istitlerune().
+inline bool IsTitle(char32 c) {
+  return internal::GetRuneInfo(c).flags & internal::kRuneTitle;
+}
+
+// Same as isideographicrune().
+inline bool IsIdeographic(char32 c) {
+  return internal::GetRuneInfo(c).flags & internal::kRuneIdeographic;
+}
+
+// Same as toupperrune().
+inline char32 ToUpper(char32 c) {
+  return c + internal::GetRuneInfo(c).upper_delta;
+}
+
+// Same as tolowerrune().
+inline char32 ToLower(char32 c) {
+  return c + internal::GetRuneInfo(c).lower_delta;
+}
+
+// Same as totitlerune().
+inline char32 ToTitle(char32 c) {
+  return c + internal::GetRuneInfo(c).title_delta;
+}
+
+}  // namespace UniLib
+
+#endif  // GXL_UTF8_UNILIB_RUNETYPE_H_
@@ -0,0 +1,161 @@
+/**
+ * Copyright 2010 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Generates unilib_runetype_tables.cc from the range tables of
+// third_party/utf. After changing those tables, run from gxl/utf8:
+//
+//   bazel run :unilib_runetype_gen > unilib_runetype_tables.cc
+
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "absl/strings/str_format.h"
+#include "gxl/utf8/unilib_runetype.h"
+#include "third_party/utf/utf.h"
+
+namespace {
+
+using UniLib::internal::kRuneNumPages;
+using UniLib::internal::kRunePageBits;
+
+constexpr int kPageSize = 1 << kRunePageBits;
+
+// flags, upper_delta, lower_delta, title_delta.
+typedef std::tuple<int, int, int, int> Info;
+
+Info GetInfo(Rune c) {
+  int flags = 0;
+  if (isspacerune(c))
+    flags |= UniLib::internal::kRuneSpace;
+  if (isdigitrune(c))
+    flags |= UniLib::internal::kRuneDigit;
+  if (isalpharune(c))
+    flags |= UniLib::internal::kRuneAlpha;
+  if (isupperrune(c))
+    flags |= UniLib::internal::kRuneUpper;
+  if (islowerrune(c))
+    flags |= UniLib::internal::kRuneLower;
+  if (istitlerune(c))
+    flags |= UniLib::internal::kRuneTitle;
+  if (isideographicrune(c))
+    flags |= UniLib::internal::kRuneIdeographic;
+  return Info(flags, toupperrune(c) - c, tolowerrune(c) - c,
+              totitlerune(c) - c);
+}
+
+// Prints "values" as the body of a C array initializer, 16 per line.
+void PrintValues(const std::vector<int>& values, const char* indent) {
+  for (size_t i = 0; i < values.size(); ++i) {
+    if (i % 16 == 0)
+      printf("%s", indent);
+    printf("%3d,", values[i]);
+    if (i % 16 == 15 || i + 1 == values.size())
+      printf("\n");
+  }
+}
+
+void Fail(const std::string& message) {
+  fprintf(stderr, "%s\n", message.c_str());
+  exit(EXIT_FAILURE);
+}
+
+}  // namespace
+
+int main() {
+  // Numbers the distinct infos and blocks in order of first use, so that
+  // info 0 and the block of page 0 describe U+0000.
+  std::map<Info, int> info_ids;
+  std::vector<Info> infos;
+  std::map<std::vector<int>, int> block_ids;
+  std::vector<std::vector<int>> blocks;
+  std::vector<int> page_blocks;
+  for (Rune page = 0; page < static_cast<Rune>(kRuneNumPages); ++page) {
+    std::vector<int> block;
+    for (Rune c = page * kPageSize; c < (page + 1) * kPageSize; ++c) {
+      const Info info = GetInfo(c);
+      auto inserted = info_ids.emplace(info, infos.size());
+      if (inserted.second)
+        infos.push_back(info);
+      block.push_back(inserted.first->second);
+    }
+    auto inserted = block_ids.emplace(block, blocks.size());
+    if (inserted.second)
+      blocks.push_back(block);
+    page_blocks.push_back(inserted.first->second);
+  }
+  if (infos[0] != Info(0, 0, 0, 0))
+    Fail("U+0000 has properties");
+  // Codepoints out of range use a block without properties.
+  auto empty_block = block_ids.find(std::vector<int>(kPageSize, 0));
+  if (empty_block == block_ids.end())
+    Fail("No page is without properties");
+  page_blocks.push_back(empty_block->second);
+  if (infos.size() > 256 || blocks.size() > 256)
+    Fail(absl::StrFormat("%d infos and %d blocks do not fit in uint8_t",
+                         infos.size(), blocks.size()));
+
+  printf(R"(/**
+ * Copyright 2010 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Generated by unilib_runetype_gen. Do not edit.
+
+// clang-format off
+
+#include <cstdint>
+
+#include "gxl/utf8/unilib_runetype.h"
+
+namespace UniLib {
+namespace internal {
+
+)");
+  printf("const uint8_t kRunePageBlocks[kRuneNumPages + 1] = {\n");
+  PrintValues(page_blocks, "    ");
+  printf("};\n\n");
+  printf("const uint8_t kRuneBlockInfos[][1 << kRunePageBits] = {\n");
+  for (size_t i = 0; i < blocks.size(); ++i) {
+    printf("    {  // %zu\n", i);
+    PrintValues(blocks[i], "        ");
+    printf("    },\n");
+  }
+  printf("};\n\n");
+  printf("const RuneInfo kRuneInfos[] = {\n");
+  for (const Info& info : infos) {
+    printf("    {0x%02x, %d, %d, %d},\n", std::get<0>(info), std::get<1>(info),
+           std::get<2>(info), std::get<3>(info));
+  }
+  printf("};\n\n");
+  printf("}  // namespace internal\n");
+  printf("}  // namespace UniLib\n");
+  return EXIT_SUCCESS;
+}